@@ -0,0 +1,77 @@
+// apply_for with a runtime index against a plain chain of index comparisons, over tuples of 2 to 64 elements,
+// apply_for only dispatches through a function table from detail::apply_table_min_size elements on,
+// below that it should be the same as the chain
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "simple/support/tuple_utils.hpp"
+
+using namespace simple::support;
+
+template <std::size_t... I>
+auto make_tuple_of(std::index_sequence<I...>) -> std::tuple<std::integral_constant<unsigned, I>...>;
+template <std::size_t Size>
+using tuple_of = decltype(make_tuple_of(std::make_index_sequence<Size>{}));
+
+struct scramble
+{
+	unsigned state;
+	template <typename T>
+	unsigned operator()(T) { return state = state * 2654435761u + T::value; }
+};
+
+template <std::size_t I = 0, typename F, typename Tuple>
+unsigned comparison_chain(std::size_t index, F& f, const Tuple& tuple)
+{
+	if constexpr (I + 1 < std::tuple_size_v<Tuple>)
+		if(I != index)
+			return comparison_chain<I + 1>(index, f, tuple);
+	return f(std::get<I>(tuple));
+}
+
+template <typename Dispatch>
+double nanoseconds_per_call(const std::vector<std::size_t>& indices, Dispatch dispatch)
+{
+	using clock = std::chrono::steady_clock;
+	scramble f{1};
+	const auto start = clock::now();
+	for(int repeat = 0; repeat < 100; ++repeat)
+		for(auto index : indices)
+			dispatch(index, f);
+	const std::chrono::duration<double, std::nano> time = clock::now() - start;
+	// so the calls can't be dropped
+	if(f.state == 0)
+		std::puts("");
+	return time.count() / (indices.size() * 100);
+}
+
+template <std::size_t Size>
+void benchmark()
+{
+	const tuple_of<Size> tuple{};
+	std::mt19937 random{Size};
+	std::vector<std::size_t> indices(100'000);
+	for(auto& index : indices)
+		index = random() % Size;
+
+	const double dispatch = nanoseconds_per_call(indices,
+		[&](std::size_t index, scramble& f) { apply_for(index, f, tuple); });
+	const double chain = nanoseconds_per_call(indices,
+		[&](std::size_t index, scramble& f) { comparison_chain(index, f, tuple); });
+	std::printf("%2zu elements: apply_for %5.2f ns, comparison chain %5.2f ns\n", Size, dispatch, chain);
+}
+
+int main()
+{
+	benchmark<2>();
+	benchmark<4>();
+	benchmark<8>();
+	benchmark<16>();
+	benchmark<32>();
+	benchmark<64>();
+	return 0;
+}
@@ -0,0 +1,109 @@
+// count_trailing_zeros and count_ones, the compiler builtins against
+// the std::bitset loops that the portable versions used to be
+// and the de Bruijn multiplication and SWAR that replaced them,
+// for 32 and 64 bit inputs with the lowest set bit anywhere
+// (without -mpopcnt or similar in .cxxflags the popcount builtin is a library call)
+#include <bitset>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "simple/support/bits.hpp"
+
+using namespace simple::support;
+
+// the old portable versions
+template <typename Int>
+int bitset_count_trailing_zeros(Int in) noexcept
+{
+	const std::bitset<sizeof(Int) * CHAR_BIT> bin(in);
+	int count = -1;
+	while(!bin[++count]);
+	return count;
+}
+
+template <typename Int>
+int bitset_count_ones(Int in) noexcept
+{
+	const std::bitset<sizeof(Int) * CHAR_BIT> bin(in);
+	int count = 0;
+	for(std::size_t i = 0; i < bin.size(); ++i)
+		count += bin[i];
+	return count;
+}
+
+template <typename Int>
+int builtin_count_trailing_zeros(Int in) noexcept
+{
+	if constexpr (sizeof(Int) <= sizeof(unsigned))
+		return __builtin_ctz(in);
+	else
+		return __builtin_ctzll(in);
+}
+
+template <typename Int>
+int builtin_count_ones(Int in) noexcept
+{
+	if constexpr (sizeof(Int) <= sizeof(unsigned))
+		return __builtin_popcount(in);
+	else
+		return __builtin_popcountll(in);
+}
+
+template <typename Int, typename Count>
+double nanoseconds_per_count(const std::vector<Int>& inputs, Count count)
+{
+	using clock = std::chrono::steady_clock;
+	long long sum = 0;
+	const auto start = clock::now();
+	for(int repeat = 0; repeat < 20; ++repeat)
+		for(auto input : inputs)
+			sum += count(input);
+	const std::chrono::duration<double, std::nano> time = clock::now() - start;
+	// so the counts can't be dropped
+	if(sum == 0)
+		std::puts("");
+	return time.count() / (inputs.size() * 20);
+}
+
+template <typename Int>
+void benchmark()
+{
+	constexpr int digits = sizeof(Int) * CHAR_BIT;
+	std::mt19937_64 random{digits};
+	std::vector<Int> inputs(100'000);
+	for(auto& input : inputs)
+	{
+		// random bits above a random lowest set one, so the loops don't always stop early
+		input = Int(random()) | Int(1);
+		input <<= random() % digits;
+	}
+
+	const double builtin_ctz = nanoseconds_per_count(inputs,
+		[](Int x) { return builtin_count_trailing_zeros(x); });
+	const double bitset_ctz = nanoseconds_per_count(inputs,
+		[](Int x) { return bitset_count_trailing_zeros(x); });
+	const double de_bruijn_ctz = nanoseconds_per_count(inputs,
+		[](Int x) { return detail::de_bruijn_count_trailing_zeros(x); });
+	std::printf("%2d bit count_trailing_zeros: builtin %5.2f ns, bitset %6.2f ns, de Bruijn %5.2f ns\n",
+		digits, builtin_ctz, bitset_ctz, de_bruijn_ctz);
+
+	const double builtin_ones = nanoseconds_per_count(inputs,
+		[](Int x) { return builtin_count_ones(x); });
+	const double bitset_ones = nanoseconds_per_count(inputs,
+		[](Int x) { return bitset_count_ones(x); });
+	const double swar_ones = nanoseconds_per_count(inputs,
+		[](Int x) { return detail::swar_count_ones(x); });
+	std::printf("%2d bit count_ones:           builtin %5.2f ns, bitset %6.2f ns, SWAR     %5.2f ns\n",
+		digits, builtin_ones, bitset_ones, swar_ones);
+}
+
+int main()
+{
+	benchmark<std::uint32_t>();
+	benchmark<std::uint64_t>();
+	return 0;
+}
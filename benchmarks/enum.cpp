@@ -0,0 +1,70 @@
+// mapped enum name lookup, the perfect hash against the linear scan it replaced
+// (perfect_hash itself scans below its minimum size, so the small ones should be the same),
+// for 2 to 500 names, looking up names in the set and a few that aren't
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "simple/support/enum.hpp"
+
+using namespace simple::support;
+
+template <typename Find>
+double nanoseconds_per_lookup(const std::vector<std::string>& lookups, Find find)
+{
+	using clock = std::chrono::steady_clock;
+	std::size_t sum = 0;
+	const auto start = clock::now();
+	for(int repeat = 0; repeat < 20; ++repeat)
+		for(auto& name : lookups)
+			sum += find(name);
+	const std::chrono::duration<double, std::nano> time = clock::now() - start;
+	// so the lookups can't be dropped
+	if(sum == 0)
+		std::puts("");
+	return time.count() / (lookups.size() * 20);
+}
+
+void benchmark(std::size_t size)
+{
+	std::mt19937 random{unsigned(size)};
+	auto random_name = [&]()
+	{
+		// identifier like, with a common prefix, like enum names tend to have
+		std::string name = "value_";
+		name.resize(name.size() + 3 + random() % 10);
+		for(std::size_t i = 6; i < name.size(); ++i)
+			name[i] = 'a' + random() % 26;
+		return name;
+	};
+
+	std::vector<std::string> names(size);
+	for(auto& name : names)
+		name = random_name();
+
+	std::vector<std::string> lookups(100'000);
+	for(auto& name : lookups)
+		name = random() % 8 ? names[random() % size] : random_name();
+
+	const enum_details::perfect_hash hash({names.begin(), names.end()});
+	const double hashed = nanoseconds_per_lookup(lookups,
+		[&](std::string_view name) { return hash.find(name); });
+	const double linear = nanoseconds_per_lookup(lookups,
+		[&](std::string_view name) { return std::size_t(std::find(names.begin(), names.end(), name) - names.begin()); });
+	std::printf("%3zu names: perfect hash %6.2f ns, linear scan %7.2f ns\n", size, hashed, linear);
+}
+
+int main()
+{
+	benchmark(2);
+	benchmark(5);
+	benchmark(10);
+	benchmark(20);
+	benchmark(100);
+	benchmark(500);
+	return 0;
+}
@@ -0,0 +1,24 @@
+// apply_for with a runtime index, checked by check.awk in the generated assembly:
+// from detail::apply_table_min_size elements on a single indirect call and no branches,
+// below that plain comparisons and no indirect call
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include "simple/support/tuple_utils.hpp"
+
+using namespace simple::support;
+
+template <std::size_t... I>
+auto make_tuple_of(std::index_sequence<I...>) -> std::tuple<std::integral_constant<int, I>...>;
+template <std::size_t Size>
+using tuple_of = decltype(make_tuple_of(std::make_index_sequence<Size>{}));
+
+struct value
+{
+	template <typename T>
+	int operator()(T) const { return T::value * 3 + 1; }
+};
+
+extern "C" int chain_2(std::size_t index) { return apply_for(index, value{}, tuple_of<2>{}); }
+extern "C" int table_16(std::size_t index) { return apply_for(index, value{}, tuple_of<16>{}); }
+extern "C" int table_64(std::size_t index) { return apply_for(index, value{}, tuple_of<64>{}); }
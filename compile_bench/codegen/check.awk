@@ -0,0 +1,28 @@
+# checks x86-64 assembly in AT&T syntax (the gcc and clang default),
+# functions named table_* must dispatch with exactly one indirect call or jump, no conditional branches,
+# and only a handful of instructions around it (not, say, filling in the table on the stack first),
+# functions named chain_* must not have any indirect calls or jumps
+
+function finish()
+{
+	if(name ~ /^table_/ && (indirect != 1 || branches != 0 || instructions > 16))
+	{
+		printf "%s: %d indirect calls, %d conditional branches and %d instructions, expected a single indirect call\n",
+			name, indirect, branches, instructions
+		failed = 1
+	}
+	if(name ~ /^chain_/ && indirect != 0)
+	{
+		printf "%s: %d indirect calls, expected none\n", name, indirect
+		failed = 1
+	}
+	name = ""
+}
+
+/^(table|chain)_[0-9A-Za-z_]*:/ { finish(); name = substr($1, 1, length($1) - 1); indirect = 0; branches = 0; instructions = 0; next }
+name && /^\t\.cfi_endproc/ { finish(); next }
+name && /^\t[a-z]/ { ++instructions }
+name && /^\t(call|jmp)q?\t\*/ { ++indirect }
+name && /^\tj[a-z]+\t/ && !/^\tjmpq?\t/ { ++branches }
+
+END { finish(); exit failed }
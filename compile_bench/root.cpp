@@ -0,0 +1,75 @@
+// Not a test, but a compile time benchmark of the floating point roots.
+// Each is evaluated in constant expressions on up to SIMPLE_COMPILE_BENCH_SIZE inputs
+// spread over the whole exponent range, so the constant evaluator does all the iterations.
+// The square root also counts its steps against the bound derived from the estimate,
+// so a worse estimate fails to compile, and so does a loop that doesn't stop
+// (it runs into the constexpr loop limit instead).
+#include <limits>
+#include "simple/support/math/root.hpp"
+
+using namespace simple::support;
+
+#ifndef SIMPLE_COMPILE_BENCH_SIZE
+#define SIMPLE_COMPILE_BENCH_SIZE 1024
+#endif
+
+constexpr int size = SIMPLE_COMPILE_BENCH_SIZE;
+
+// geometric sweep up from the smallest normal number, with an irregular mantissa,
+// stretched to cover the exponent range in about size steps
+template <typename Float, typename Check>
+constexpr bool sweep(Check check)
+{
+	using limits = std::numeric_limits<Float>;
+	Float factor = Float(1.37);
+	for(int i = 0; i < (limits::max_exponent - limits::min_exponent) / size; ++i)
+		factor *= 2;
+
+	Float n = limits::min();
+	// the checks add two of these together
+	for(int i = 0; i < size && n < limits::max() / 4 / factor; ++i, n *= factor)
+		if(not check(n))
+			return false;
+	return true;
+}
+
+template <typename Float>
+constexpr bool root2_check(Float n)
+{
+	auto guess = detail::root_estimate<2>(n);
+	int iterations = 0;
+	auto counting_eq = [&iterations](Float a, Float b)
+	{
+		++iterations;
+		return almost_equal(a, b);
+	};
+	Float root = babelonian_root2(n, counting_eq);
+	return iterations <= detail::root2_iteration_bound<Float>(guess.correct_bits)
+		&& almost_equal(root, babelonian_root2_f(n))
+		&& equal_ulp(root * root, n, 2);
+}
+
+template <int N, typename Float>
+constexpr bool root_check(Float n)
+{
+	// the rounding of the root gets multiplied by N, and the power rounds N - 1 times
+	return equal_ulp(detail::power<N>(root<N>(n)), n, 2 * N);
+}
+
+static_assert(sweep<float>(root2_check<float>));
+static_assert(sweep<double>(root2_check<double>));
+static_assert(sweep<long double>(root2_check<long double>));
+
+static_assert(sweep<float>(root_check<3, float>));
+static_assert(sweep<double>(root_check<3, double>));
+static_assert(sweep<long double>(root_check<3, long double>));
+
+static_assert(sweep<float>(root_check<5, float>));
+static_assert(sweep<double>(root_check<5, double>));
+static_assert(sweep<long double>(root_check<5, long double>));
+
+static_assert(sweep<double>(root_check<7, double>));
+static_assert(sweep<double>(root_check<16, double>));
+static_assert(sweep<long double>(root_check<16, long double>));
+
+int main() {}
@@ -0,0 +1,1109 @@
+	.file	"apply_for.cpp"
+	.text
+	.section	.text._ZN6simple7support6detail8apply_atILm0E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm0E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm0E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm0E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm0E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_:
+.LFB4100:
+	.cfi_startproc
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE4100:
+	.size	_ZN6simple7support6detail8apply_atILm0E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm0E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm1E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm1E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm1E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm1E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm1E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_:
+.LFB4101:
+	.cfi_startproc
+	movl	$4, %eax
+	ret
+	.cfi_endproc
+.LFE4101:
+	.size	_ZN6simple7support6detail8apply_atILm1E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm1E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm2E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm2E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm2E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm2E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm2E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_:
+.LFB4102:
+	.cfi_startproc
+	movl	$7, %eax
+	ret
+	.cfi_endproc
+.LFE4102:
+	.size	_ZN6simple7support6detail8apply_atILm2E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm2E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm3E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm3E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm3E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm3E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm3E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_:
+.LFB4104:
+	.cfi_startproc
+	movl	$10, %eax
+	ret
+	.cfi_endproc
+.LFE4104:
+	.size	_ZN6simple7support6detail8apply_atILm3E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm3E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm4E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm4E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm4E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm4E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm4E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_:
+.LFB4106:
+	.cfi_startproc
+	movl	$13, %eax
+	ret
+	.cfi_endproc
+.LFE4106:
+	.size	_ZN6simple7support6detail8apply_atILm4E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm4E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm5E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm5E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm5E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm5E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm5E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_:
+.LFB4108:
+	.cfi_startproc
+	movl	$16, %eax
+	ret
+	.cfi_endproc
+.LFE4108:
+	.size	_ZN6simple7support6detail8apply_atILm5E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm5E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm6E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm6E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm6E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm6E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm6E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_:
+.LFB4110:
+	.cfi_startproc
+	movl	$19, %eax
+	ret
+	.cfi_endproc
+.LFE4110:
+	.size	_ZN6simple7support6detail8apply_atILm6E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm6E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm7E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm7E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm7E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm7E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm7E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_:
+.LFB4112:
+	.cfi_startproc
+	movl	$22, %eax
+	ret
+	.cfi_endproc
+.LFE4112:
+	.size	_ZN6simple7support6detail8apply_atILm7E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm7E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm8E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm8E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm8E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm8E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm8E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_:
+.LFB4114:
+	.cfi_startproc
+	movl	$25, %eax
+	ret
+	.cfi_endproc
+.LFE4114:
+	.size	_ZN6simple7support6detail8apply_atILm8E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm8E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm9E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm9E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm9E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm9E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm9E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_:
+.LFB4116:
+	.cfi_startproc
+	movl	$28, %eax
+	ret
+	.cfi_endproc
+.LFE4116:
+	.size	_ZN6simple7support6detail8apply_atILm9E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm9E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm10E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm10E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm10E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm10E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm10E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_:
+.LFB4118:
+	.cfi_startproc
+	movl	$31, %eax
+	ret
+	.cfi_endproc
+.LFE4118:
+	.size	_ZN6simple7support6detail8apply_atILm10E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm10E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm11E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm11E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm11E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm11E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm11E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_:
+.LFB4120:
+	.cfi_startproc
+	movl	$34, %eax
+	ret
+	.cfi_endproc
+.LFE4120:
+	.size	_ZN6simple7support6detail8apply_atILm11E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm11E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm12E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm12E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm12E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm12E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm12E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_:
+.LFB4122:
+	.cfi_startproc
+	movl	$37, %eax
+	ret
+	.cfi_endproc
+.LFE4122:
+	.size	_ZN6simple7support6detail8apply_atILm12E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm12E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm13E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm13E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm13E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm13E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm13E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_:
+.LFB4124:
+	.cfi_startproc
+	movl	$40, %eax
+	ret
+	.cfi_endproc
+.LFE4124:
+	.size	_ZN6simple7support6detail8apply_atILm13E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm13E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm14E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm14E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm14E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm14E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm14E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_:
+.LFB4126:
+	.cfi_startproc
+	movl	$43, %eax
+	ret
+	.cfi_endproc
+.LFE4126:
+	.size	_ZN6simple7support6detail8apply_atILm14E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm14E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm15E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm15E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm15E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm15E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm15E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_:
+.LFB4128:
+	.cfi_startproc
+	movl	$46, %eax
+	ret
+	.cfi_endproc
+.LFE4128:
+	.size	_ZN6simple7support6detail8apply_atILm15E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm15E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm0E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm0E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm0E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm0E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm0E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4233:
+	.cfi_startproc
+	movl	$1, %eax
+	ret
+	.cfi_endproc
+.LFE4233:
+	.size	_ZN6simple7support6detail8apply_atILm0E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm0E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm1E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm1E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm1E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm1E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm1E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4234:
+	.cfi_startproc
+	movl	$4, %eax
+	ret
+	.cfi_endproc
+.LFE4234:
+	.size	_ZN6simple7support6detail8apply_atILm1E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm1E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm2E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm2E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm2E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm2E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm2E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4235:
+	.cfi_startproc
+	movl	$7, %eax
+	ret
+	.cfi_endproc
+.LFE4235:
+	.size	_ZN6simple7support6detail8apply_atILm2E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm2E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm3E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm3E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm3E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm3E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm3E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4236:
+	.cfi_startproc
+	movl	$10, %eax
+	ret
+	.cfi_endproc
+.LFE4236:
+	.size	_ZN6simple7support6detail8apply_atILm3E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm3E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm4E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm4E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm4E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm4E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm4E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4237:
+	.cfi_startproc
+	movl	$13, %eax
+	ret
+	.cfi_endproc
+.LFE4237:
+	.size	_ZN6simple7support6detail8apply_atILm4E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm4E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm5E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm5E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm5E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm5E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm5E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4238:
+	.cfi_startproc
+	movl	$16, %eax
+	ret
+	.cfi_endproc
+.LFE4238:
+	.size	_ZN6simple7support6detail8apply_atILm5E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm5E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm6E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm6E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm6E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm6E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm6E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4239:
+	.cfi_startproc
+	movl	$19, %eax
+	ret
+	.cfi_endproc
+.LFE4239:
+	.size	_ZN6simple7support6detail8apply_atILm6E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm6E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm7E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm7E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm7E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm7E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm7E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4240:
+	.cfi_startproc
+	movl	$22, %eax
+	ret
+	.cfi_endproc
+.LFE4240:
+	.size	_ZN6simple7support6detail8apply_atILm7E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm7E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm8E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm8E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm8E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm8E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm8E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4241:
+	.cfi_startproc
+	movl	$25, %eax
+	ret
+	.cfi_endproc
+.LFE4241:
+	.size	_ZN6simple7support6detail8apply_atILm8E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm8E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm9E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm9E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm9E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm9E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm9E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4242:
+	.cfi_startproc
+	movl	$28, %eax
+	ret
+	.cfi_endproc
+.LFE4242:
+	.size	_ZN6simple7support6detail8apply_atILm9E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm9E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm10E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm10E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm10E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm10E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm10E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4243:
+	.cfi_startproc
+	movl	$31, %eax
+	ret
+	.cfi_endproc
+.LFE4243:
+	.size	_ZN6simple7support6detail8apply_atILm10E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm10E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm11E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm11E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm11E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm11E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm11E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4244:
+	.cfi_startproc
+	movl	$34, %eax
+	ret
+	.cfi_endproc
+.LFE4244:
+	.size	_ZN6simple7support6detail8apply_atILm11E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm11E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm12E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm12E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm12E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm12E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm12E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4245:
+	.cfi_startproc
+	movl	$37, %eax
+	ret
+	.cfi_endproc
+.LFE4245:
+	.size	_ZN6simple7support6detail8apply_atILm12E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm12E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm13E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm13E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm13E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm13E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm13E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4246:
+	.cfi_startproc
+	movl	$40, %eax
+	ret
+	.cfi_endproc
+.LFE4246:
+	.size	_ZN6simple7support6detail8apply_atILm13E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm13E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm14E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm14E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm14E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm14E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm14E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4247:
+	.cfi_startproc
+	movl	$43, %eax
+	ret
+	.cfi_endproc
+.LFE4247:
+	.size	_ZN6simple7support6detail8apply_atILm14E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm14E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm15E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm15E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm15E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm15E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm15E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4248:
+	.cfi_startproc
+	movl	$46, %eax
+	ret
+	.cfi_endproc
+.LFE4248:
+	.size	_ZN6simple7support6detail8apply_atILm15E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm15E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm16E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm16E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm16E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm16E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm16E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4249:
+	.cfi_startproc
+	movl	$49, %eax
+	ret
+	.cfi_endproc
+.LFE4249:
+	.size	_ZN6simple7support6detail8apply_atILm16E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm16E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm17E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm17E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm17E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm17E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm17E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4251:
+	.cfi_startproc
+	movl	$52, %eax
+	ret
+	.cfi_endproc
+.LFE4251:
+	.size	_ZN6simple7support6detail8apply_atILm17E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm17E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm18E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm18E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm18E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm18E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm18E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4253:
+	.cfi_startproc
+	movl	$55, %eax
+	ret
+	.cfi_endproc
+.LFE4253:
+	.size	_ZN6simple7support6detail8apply_atILm18E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm18E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm19E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm19E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm19E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm19E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm19E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4255:
+	.cfi_startproc
+	movl	$58, %eax
+	ret
+	.cfi_endproc
+.LFE4255:
+	.size	_ZN6simple7support6detail8apply_atILm19E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm19E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm20E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm20E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm20E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm20E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm20E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4257:
+	.cfi_startproc
+	movl	$61, %eax
+	ret
+	.cfi_endproc
+.LFE4257:
+	.size	_ZN6simple7support6detail8apply_atILm20E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm20E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm21E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm21E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm21E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm21E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm21E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4259:
+	.cfi_startproc
+	movl	$64, %eax
+	ret
+	.cfi_endproc
+.LFE4259:
+	.size	_ZN6simple7support6detail8apply_atILm21E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm21E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm22E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm22E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm22E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm22E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm22E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4261:
+	.cfi_startproc
+	movl	$67, %eax
+	ret
+	.cfi_endproc
+.LFE4261:
+	.size	_ZN6simple7support6detail8apply_atILm22E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm22E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm23E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm23E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm23E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm23E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm23E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4263:
+	.cfi_startproc
+	movl	$70, %eax
+	ret
+	.cfi_endproc
+.LFE4263:
+	.size	_ZN6simple7support6detail8apply_atILm23E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm23E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm24E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm24E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm24E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm24E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm24E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4265:
+	.cfi_startproc
+	movl	$73, %eax
+	ret
+	.cfi_endproc
+.LFE4265:
+	.size	_ZN6simple7support6detail8apply_atILm24E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm24E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm25E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm25E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm25E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm25E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm25E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4267:
+	.cfi_startproc
+	movl	$76, %eax
+	ret
+	.cfi_endproc
+.LFE4267:
+	.size	_ZN6simple7support6detail8apply_atILm25E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm25E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm26E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm26E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm26E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm26E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm26E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4269:
+	.cfi_startproc
+	movl	$79, %eax
+	ret
+	.cfi_endproc
+.LFE4269:
+	.size	_ZN6simple7support6detail8apply_atILm26E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm26E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm27E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm27E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm27E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm27E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm27E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4271:
+	.cfi_startproc
+	movl	$82, %eax
+	ret
+	.cfi_endproc
+.LFE4271:
+	.size	_ZN6simple7support6detail8apply_atILm27E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm27E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm28E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm28E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm28E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm28E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm28E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4273:
+	.cfi_startproc
+	movl	$85, %eax
+	ret
+	.cfi_endproc
+.LFE4273:
+	.size	_ZN6simple7support6detail8apply_atILm28E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm28E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm29E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm29E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm29E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm29E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm29E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4275:
+	.cfi_startproc
+	movl	$88, %eax
+	ret
+	.cfi_endproc
+.LFE4275:
+	.size	_ZN6simple7support6detail8apply_atILm29E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm29E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm30E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm30E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm30E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm30E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm30E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4277:
+	.cfi_startproc
+	movl	$91, %eax
+	ret
+	.cfi_endproc
+.LFE4277:
+	.size	_ZN6simple7support6detail8apply_atILm30E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm30E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm31E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm31E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm31E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm31E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm31E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4279:
+	.cfi_startproc
+	movl	$94, %eax
+	ret
+	.cfi_endproc
+.LFE4279:
+	.size	_ZN6simple7support6detail8apply_atILm31E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm31E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm32E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm32E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm32E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm32E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm32E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4281:
+	.cfi_startproc
+	movl	$97, %eax
+	ret
+	.cfi_endproc
+.LFE4281:
+	.size	_ZN6simple7support6detail8apply_atILm32E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm32E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm33E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm33E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm33E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm33E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm33E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4283:
+	.cfi_startproc
+	movl	$100, %eax
+	ret
+	.cfi_endproc
+.LFE4283:
+	.size	_ZN6simple7support6detail8apply_atILm33E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm33E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm34E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm34E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm34E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm34E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm34E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4285:
+	.cfi_startproc
+	movl	$103, %eax
+	ret
+	.cfi_endproc
+.LFE4285:
+	.size	_ZN6simple7support6detail8apply_atILm34E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm34E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm35E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm35E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm35E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm35E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm35E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4287:
+	.cfi_startproc
+	movl	$106, %eax
+	ret
+	.cfi_endproc
+.LFE4287:
+	.size	_ZN6simple7support6detail8apply_atILm35E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm35E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm36E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm36E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm36E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm36E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm36E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4289:
+	.cfi_startproc
+	movl	$109, %eax
+	ret
+	.cfi_endproc
+.LFE4289:
+	.size	_ZN6simple7support6detail8apply_atILm36E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm36E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm37E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm37E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm37E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm37E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm37E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4291:
+	.cfi_startproc
+	movl	$112, %eax
+	ret
+	.cfi_endproc
+.LFE4291:
+	.size	_ZN6simple7support6detail8apply_atILm37E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm37E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm38E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm38E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm38E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm38E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm38E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4293:
+	.cfi_startproc
+	movl	$115, %eax
+	ret
+	.cfi_endproc
+.LFE4293:
+	.size	_ZN6simple7support6detail8apply_atILm38E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm38E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm39E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm39E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm39E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm39E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm39E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4295:
+	.cfi_startproc
+	movl	$118, %eax
+	ret
+	.cfi_endproc
+.LFE4295:
+	.size	_ZN6simple7support6detail8apply_atILm39E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm39E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm40E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm40E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm40E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm40E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm40E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4297:
+	.cfi_startproc
+	movl	$121, %eax
+	ret
+	.cfi_endproc
+.LFE4297:
+	.size	_ZN6simple7support6detail8apply_atILm40E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm40E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm41E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm41E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm41E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm41E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm41E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4299:
+	.cfi_startproc
+	movl	$124, %eax
+	ret
+	.cfi_endproc
+.LFE4299:
+	.size	_ZN6simple7support6detail8apply_atILm41E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm41E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm42E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm42E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm42E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm42E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm42E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4301:
+	.cfi_startproc
+	movl	$127, %eax
+	ret
+	.cfi_endproc
+.LFE4301:
+	.size	_ZN6simple7support6detail8apply_atILm42E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm42E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm43E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm43E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm43E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm43E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm43E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4303:
+	.cfi_startproc
+	movl	$130, %eax
+	ret
+	.cfi_endproc
+.LFE4303:
+	.size	_ZN6simple7support6detail8apply_atILm43E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm43E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm44E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm44E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm44E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm44E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm44E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4305:
+	.cfi_startproc
+	movl	$133, %eax
+	ret
+	.cfi_endproc
+.LFE4305:
+	.size	_ZN6simple7support6detail8apply_atILm44E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm44E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm45E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm45E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm45E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm45E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm45E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4307:
+	.cfi_startproc
+	movl	$136, %eax
+	ret
+	.cfi_endproc
+.LFE4307:
+	.size	_ZN6simple7support6detail8apply_atILm45E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm45E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm46E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm46E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm46E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm46E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm46E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4309:
+	.cfi_startproc
+	movl	$139, %eax
+	ret
+	.cfi_endproc
+.LFE4309:
+	.size	_ZN6simple7support6detail8apply_atILm46E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm46E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm47E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm47E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm47E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm47E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm47E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4311:
+	.cfi_startproc
+	movl	$142, %eax
+	ret
+	.cfi_endproc
+.LFE4311:
+	.size	_ZN6simple7support6detail8apply_atILm47E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm47E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm48E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm48E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm48E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm48E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm48E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4313:
+	.cfi_startproc
+	movl	$145, %eax
+	ret
+	.cfi_endproc
+.LFE4313:
+	.size	_ZN6simple7support6detail8apply_atILm48E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm48E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm49E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm49E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm49E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm49E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm49E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4315:
+	.cfi_startproc
+	movl	$148, %eax
+	ret
+	.cfi_endproc
+.LFE4315:
+	.size	_ZN6simple7support6detail8apply_atILm49E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm49E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm50E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm50E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm50E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm50E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm50E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4317:
+	.cfi_startproc
+	movl	$151, %eax
+	ret
+	.cfi_endproc
+.LFE4317:
+	.size	_ZN6simple7support6detail8apply_atILm50E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm50E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm51E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm51E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm51E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm51E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm51E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4319:
+	.cfi_startproc
+	movl	$154, %eax
+	ret
+	.cfi_endproc
+.LFE4319:
+	.size	_ZN6simple7support6detail8apply_atILm51E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm51E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm52E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm52E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm52E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm52E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm52E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4321:
+	.cfi_startproc
+	movl	$157, %eax
+	ret
+	.cfi_endproc
+.LFE4321:
+	.size	_ZN6simple7support6detail8apply_atILm52E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm52E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm53E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm53E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm53E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm53E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm53E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4323:
+	.cfi_startproc
+	movl	$160, %eax
+	ret
+	.cfi_endproc
+.LFE4323:
+	.size	_ZN6simple7support6detail8apply_atILm53E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm53E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm54E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm54E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm54E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm54E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm54E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4325:
+	.cfi_startproc
+	movl	$163, %eax
+	ret
+	.cfi_endproc
+.LFE4325:
+	.size	_ZN6simple7support6detail8apply_atILm54E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm54E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm55E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm55E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm55E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm55E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm55E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4327:
+	.cfi_startproc
+	movl	$166, %eax
+	ret
+	.cfi_endproc
+.LFE4327:
+	.size	_ZN6simple7support6detail8apply_atILm55E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm55E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm56E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm56E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm56E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm56E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm56E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4329:
+	.cfi_startproc
+	movl	$169, %eax
+	ret
+	.cfi_endproc
+.LFE4329:
+	.size	_ZN6simple7support6detail8apply_atILm56E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm56E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm57E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm57E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm57E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm57E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm57E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4331:
+	.cfi_startproc
+	movl	$172, %eax
+	ret
+	.cfi_endproc
+.LFE4331:
+	.size	_ZN6simple7support6detail8apply_atILm57E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm57E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm58E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm58E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm58E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm58E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm58E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4333:
+	.cfi_startproc
+	movl	$175, %eax
+	ret
+	.cfi_endproc
+.LFE4333:
+	.size	_ZN6simple7support6detail8apply_atILm58E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm58E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm59E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm59E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm59E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm59E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm59E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4335:
+	.cfi_startproc
+	movl	$178, %eax
+	ret
+	.cfi_endproc
+.LFE4335:
+	.size	_ZN6simple7support6detail8apply_atILm59E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm59E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm60E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm60E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm60E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm60E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm60E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4337:
+	.cfi_startproc
+	movl	$181, %eax
+	ret
+	.cfi_endproc
+.LFE4337:
+	.size	_ZN6simple7support6detail8apply_atILm60E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm60E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm61E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm61E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm61E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm61E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm61E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4339:
+	.cfi_startproc
+	movl	$184, %eax
+	ret
+	.cfi_endproc
+.LFE4339:
+	.size	_ZN6simple7support6detail8apply_atILm61E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm61E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm62E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm62E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm62E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm62E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm62E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4341:
+	.cfi_startproc
+	movl	$187, %eax
+	ret
+	.cfi_endproc
+.LFE4341:
+	.size	_ZN6simple7support6detail8apply_atILm62E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm62E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.section	.text._ZN6simple7support6detail8apply_atILm63E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,"axG",@progbits,_ZN6simple7support6detail8apply_atILm63E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_,comdat
+	.p2align 4
+	.weak	_ZN6simple7support6detail8apply_atILm63E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.type	_ZN6simple7support6detail8apply_atILm63E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, @function
+_ZN6simple7support6detail8apply_atILm63E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_:
+.LFB4343:
+	.cfi_startproc
+	movl	$190, %eax
+	ret
+	.cfi_endproc
+.LFE4343:
+	.size	_ZN6simple7support6detail8apply_atILm63E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_, .-_ZN6simple7support6detail8apply_atILm63E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.text
+	.p2align 4
+	.globl	chain_2
+	.type	chain_2, @function
+chain_2:
+.LFB4046:
+	.cfi_startproc
+	cmpq	$1, %rdi
+	sbbl	%eax, %eax
+	andl	$-3, %eax
+	addl	$4, %eax
+	ret
+	.cfi_endproc
+.LFE4046:
+	.size	chain_2, .-chain_2
+	.p2align 4
+	.globl	table_16
+	.type	table_16, @function
+table_16:
+.LFB4065:
+	.cfi_startproc
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rdx
+	leaq	_ZN6simple7support6detail11apply_tableISt16integer_sequenceImJLm0ELm1ELm2ELm3ELm4ELm5ELm6ELm7ELm8ELm9ELm10ELm11ELm12ELm13ELm14ELm15EEE5valueJSt5tupleIJSt17integral_constantIiLi0EES7_IiLi1EES7_IiLi2EES7_IiLi3EES7_IiLi4EES7_IiLi5EES7_IiLi6EES7_IiLi7EES7_IiLi8EES7_IiLi9EES7_IiLi10EES7_IiLi11EES7_IiLi12EES7_IiLi13EES7_IiLi14EES7_IiLi15EEEEEE9functionsE(%rip), %rax
+	leaq	15(%rsp), %rsi
+	leaq	14(%rsp), %rdi
+	call	*(%rax,%rdx,8)
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE4065:
+	.size	table_16, .-table_16
+	.p2align 4
+	.globl	table_64
+	.type	table_64, @function
+table_64:
+.LFB4130:
+	.cfi_startproc
+	subq	$24, %rsp
+	.cfi_def_cfa_offset 32
+	movq	%rdi, %rdx
+	leaq	_ZN6simple7support6detail11apply_tableISt16integer_sequenceImJLm0ELm1ELm2ELm3ELm4ELm5ELm6ELm7ELm8ELm9ELm10ELm11ELm12ELm13ELm14ELm15ELm16ELm17ELm18ELm19ELm20ELm21ELm22ELm23ELm24ELm25ELm26ELm27ELm28ELm29ELm30ELm31ELm32ELm33ELm34ELm35ELm36ELm37ELm38ELm39ELm40ELm41ELm42ELm43ELm44ELm45ELm46ELm47ELm48ELm49ELm50ELm51ELm52ELm53ELm54ELm55ELm56ELm57ELm58ELm59ELm60ELm61ELm62ELm63EEE5valueJSt5tupleIJSt17integral_constantIiLi0EES7_IiLi1EES7_IiLi2EES7_IiLi3EES7_IiLi4EES7_IiLi5EES7_IiLi6EES7_IiLi7EES7_IiLi8EES7_IiLi9EES7_IiLi10EES7_IiLi11EES7_IiLi12EES7_IiLi13EES7_IiLi14EES7_IiLi15EES7_IiLi16EES7_IiLi17EES7_IiLi18EES7_IiLi19EES7_IiLi20EES7_IiLi21EES7_IiLi22EES7_IiLi23EES7_IiLi24EES7_IiLi25EES7_IiLi26EES7_IiLi27EES7_IiLi28EES7_IiLi29EES7_IiLi30EES7_IiLi31EES7_IiLi32EES7_IiLi33EES7_IiLi34EES7_IiLi35EES7_IiLi36EES7_IiLi37EES7_IiLi38EES7_IiLi39EES7_IiLi40EES7_IiLi41EES7_IiLi42EES7_IiLi43EES7_IiLi44EES7_IiLi45EES7_IiLi46EES7_IiLi47EES7_IiLi48EES7_IiLi49EES7_IiLi50EES7_IiLi51EES7_IiLi52EES7_IiLi53EES7_IiLi54EES7_IiLi55EES7_IiLi56EES7_IiLi57EES7_IiLi58EES7_IiLi59EES7_IiLi60EES7_IiLi61EES7_IiLi62EES7_IiLi63EEEEEE9functionsE(%rip), %rax
+	leaq	15(%rsp), %rsi
+	leaq	14(%rsp), %rdi
+	call	*(%rax,%rdx,8)
+	addq	$24, %rsp
+	.cfi_def_cfa_offset 8
+	ret
+	.cfi_endproc
+.LFE4130:
+	.size	table_64, .-table_64
+	.weak	_ZN6simple7support6detail11apply_tableISt16integer_sequenceImJLm0ELm1ELm2ELm3ELm4ELm5ELm6ELm7ELm8ELm9ELm10ELm11ELm12ELm13ELm14ELm15ELm16ELm17ELm18ELm19ELm20ELm21ELm22ELm23ELm24ELm25ELm26ELm27ELm28ELm29ELm30ELm31ELm32ELm33ELm34ELm35ELm36ELm37ELm38ELm39ELm40ELm41ELm42ELm43ELm44ELm45ELm46ELm47ELm48ELm49ELm50ELm51ELm52ELm53ELm54ELm55ELm56ELm57ELm58ELm59ELm60ELm61ELm62ELm63EEE5valueJSt5tupleIJSt17integral_constantIiLi0EES7_IiLi1EES7_IiLi2EES7_IiLi3EES7_IiLi4EES7_IiLi5EES7_IiLi6EES7_IiLi7EES7_IiLi8EES7_IiLi9EES7_IiLi10EES7_IiLi11EES7_IiLi12EES7_IiLi13EES7_IiLi14EES7_IiLi15EES7_IiLi16EES7_IiLi17EES7_IiLi18EES7_IiLi19EES7_IiLi20EES7_IiLi21EES7_IiLi22EES7_IiLi23EES7_IiLi24EES7_IiLi25EES7_IiLi26EES7_IiLi27EES7_IiLi28EES7_IiLi29EES7_IiLi30EES7_IiLi31EES7_IiLi32EES7_IiLi33EES7_IiLi34EES7_IiLi35EES7_IiLi36EES7_IiLi37EES7_IiLi38EES7_IiLi39EES7_IiLi40EES7_IiLi41EES7_IiLi42EES7_IiLi43EES7_IiLi44EES7_IiLi45EES7_IiLi46EES7_IiLi47EES7_IiLi48EES7_IiLi49EES7_IiLi50EES7_IiLi51EES7_IiLi52EES7_IiLi53EES7_IiLi54EES7_IiLi55EES7_IiLi56EES7_IiLi57EES7_IiLi58EES7_IiLi59EES7_IiLi60EES7_IiLi61EES7_IiLi62EES7_IiLi63EEEEEE9functionsE
+	.section	.data.rel.ro.local._ZN6simple7support6detail11apply_tableISt16integer_sequenceImJLm0ELm1ELm2ELm3ELm4ELm5ELm6ELm7ELm8ELm9ELm10ELm11ELm12ELm13ELm14ELm15ELm16ELm17ELm18ELm19ELm20ELm21ELm22ELm23ELm24ELm25ELm26ELm27ELm28ELm29ELm30ELm31ELm32ELm33ELm34ELm35ELm36ELm37ELm38ELm39ELm40ELm41ELm42ELm43ELm44ELm45ELm46ELm47ELm48ELm49ELm50ELm51ELm52ELm53ELm54ELm55ELm56ELm57ELm58ELm59ELm60ELm61ELm62ELm63EEE5valueJSt5tupleIJSt17integral_constantIiLi0EES7_IiLi1EES7_IiLi2EES7_IiLi3EES7_IiLi4EES7_IiLi5EES7_IiLi6EES7_IiLi7EES7_IiLi8EES7_IiLi9EES7_IiLi10EES7_IiLi11EES7_IiLi12EES7_IiLi13EES7_IiLi14EES7_IiLi15EES7_IiLi16EES7_IiLi17EES7_IiLi18EES7_IiLi19EES7_IiLi20EES7_IiLi21EES7_IiLi22EES7_IiLi23EES7_IiLi24EES7_IiLi25EES7_IiLi26EES7_IiLi27EES7_IiLi28EES7_IiLi29EES7_IiLi30EES7_IiLi31EES7_IiLi32EES7_IiLi33EES7_IiLi34EES7_IiLi35EES7_IiLi36EES7_IiLi37EES7_IiLi38EES7_IiLi39EES7_IiLi40EES7_IiLi41EES7_IiLi42EES7_IiLi43EES7_IiLi44EES7_IiLi45EES7_IiLi46EES7_IiLi47EES7_IiLi48EES7_IiLi49EES7_IiLi50EES7_IiLi51EES7_IiLi52EES7_IiLi53EES7_IiLi54EES7_IiLi55EES7_IiLi56EES7_IiLi57EES7_IiLi58EES7_IiLi59EES7_IiLi60EES7_IiLi61EES7_IiLi62EES7_IiLi63EEEEEE9functionsE,"awG",@progbits,_ZN6simple7support6detail11apply_tableISt16integer_sequenceImJLm0ELm1ELm2ELm3ELm4ELm5ELm6ELm7ELm8ELm9ELm10ELm11ELm12ELm13ELm14ELm15ELm16ELm17ELm18ELm19ELm20ELm21ELm22ELm23ELm24ELm25ELm26ELm27ELm28ELm29ELm30ELm31ELm32ELm33ELm34ELm35ELm36ELm37ELm38ELm39ELm40ELm41ELm42ELm43ELm44ELm45ELm46ELm47ELm48ELm49ELm50ELm51ELm52ELm53ELm54ELm55ELm56ELm57ELm58ELm59ELm60ELm61ELm62ELm63EEE5valueJSt5tupleIJSt17integral_constantIiLi0EES7_IiLi1EES7_IiLi2EES7_IiLi3EES7_IiLi4EES7_IiLi5EES7_IiLi6EES7_IiLi7EES7_IiLi8EES7_IiLi9EES7_IiLi10EES7_IiLi11EES7_IiLi12EES7_IiLi13EES7_IiLi14EES7_IiLi15EES7_IiLi16EES7_IiLi17EES7_IiLi18EES7_IiLi19EES7_IiLi20EES7_IiLi21EES7_IiLi22EES7_IiLi23EES7_IiLi24EES7_IiLi25EES7_IiLi26EES7_IiLi27EES7_IiLi28EES7_IiLi29EES7_IiLi30EES7_IiLi31EES7_IiLi32EES7_IiLi33EES7_IiLi34EES7_IiLi35EES7_IiLi36EES7_IiLi37EES7_IiLi38EES7_IiLi39EES7_IiLi40EES7_IiLi41EES7_IiLi42EES7_IiLi43EES7_IiLi44EES7_IiLi45EES7_IiLi46EES7_IiLi47EES7_IiLi48EES7_IiLi49EES7_IiLi50EES7_IiLi51EES7_IiLi52EES7_IiLi53EES7_IiLi54EES7_IiLi55EES7_IiLi56EES7_IiLi57EES7_IiLi58EES7_IiLi59EES7_IiLi60EES7_IiLi61EES7_IiLi62EES7_IiLi63EEEEEE9functionsE,comdat
+	.align 32
+	.type	_ZN6simple7support6detail11apply_tableISt16integer_sequenceImJLm0ELm1ELm2ELm3ELm4ELm5ELm6ELm7ELm8ELm9ELm10ELm11ELm12ELm13ELm14ELm15ELm16ELm17ELm18ELm19ELm20ELm21ELm22ELm23ELm24ELm25ELm26ELm27ELm28ELm29ELm30ELm31ELm32ELm33ELm34ELm35ELm36ELm37ELm38ELm39ELm40ELm41ELm42ELm43ELm44ELm45ELm46ELm47ELm48ELm49ELm50ELm51ELm52ELm53ELm54ELm55ELm56ELm57ELm58ELm59ELm60ELm61ELm62ELm63EEE5valueJSt5tupleIJSt17integral_constantIiLi0EES7_IiLi1EES7_IiLi2EES7_IiLi3EES7_IiLi4EES7_IiLi5EES7_IiLi6EES7_IiLi7EES7_IiLi8EES7_IiLi9EES7_IiLi10EES7_IiLi11EES7_IiLi12EES7_IiLi13EES7_IiLi14EES7_IiLi15EES7_IiLi16EES7_IiLi17EES7_IiLi18EES7_IiLi19EES7_IiLi20EES7_IiLi21EES7_IiLi22EES7_IiLi23EES7_IiLi24EES7_IiLi25EES7_IiLi26EES7_IiLi27EES7_IiLi28EES7_IiLi29EES7_IiLi30EES7_IiLi31EES7_IiLi32EES7_IiLi33EES7_IiLi34EES7_IiLi35EES7_IiLi36EES7_IiLi37EES7_IiLi38EES7_IiLi39EES7_IiLi40EES7_IiLi41EES7_IiLi42EES7_IiLi43EES7_IiLi44EES7_IiLi45EES7_IiLi46EES7_IiLi47EES7_IiLi48EES7_IiLi49EES7_IiLi50EES7_IiLi51EES7_IiLi52EES7_IiLi53EES7_IiLi54EES7_IiLi55EES7_IiLi56EES7_IiLi57EES7_IiLi58EES7_IiLi59EES7_IiLi60EES7_IiLi61EES7_IiLi62EES7_IiLi63EEEEEE9functionsE, @gnu_unique_object
+	.size	_ZN6simple7support6detail11apply_tableISt16integer_sequenceImJLm0ELm1ELm2ELm3ELm4ELm5ELm6ELm7ELm8ELm9ELm10ELm11ELm12ELm13ELm14ELm15ELm16ELm17ELm18ELm19ELm20ELm21ELm22ELm23ELm24ELm25ELm26ELm27ELm28ELm29ELm30ELm31ELm32ELm33ELm34ELm35ELm36ELm37ELm38ELm39ELm40ELm41ELm42ELm43ELm44ELm45ELm46ELm47ELm48ELm49ELm50ELm51ELm52ELm53ELm54ELm55ELm56ELm57ELm58ELm59ELm60ELm61ELm62ELm63EEE5valueJSt5tupleIJSt17integral_constantIiLi0EES7_IiLi1EES7_IiLi2EES7_IiLi3EES7_IiLi4EES7_IiLi5EES7_IiLi6EES7_IiLi7EES7_IiLi8EES7_IiLi9EES7_IiLi10EES7_IiLi11EES7_IiLi12EES7_IiLi13EES7_IiLi14EES7_IiLi15EES7_IiLi16EES7_IiLi17EES7_IiLi18EES7_IiLi19EES7_IiLi20EES7_IiLi21EES7_IiLi22EES7_IiLi23EES7_IiLi24EES7_IiLi25EES7_IiLi26EES7_IiLi27EES7_IiLi28EES7_IiLi29EES7_IiLi30EES7_IiLi31EES7_IiLi32EES7_IiLi33EES7_IiLi34EES7_IiLi35EES7_IiLi36EES7_IiLi37EES7_IiLi38EES7_IiLi39EES7_IiLi40EES7_IiLi41EES7_IiLi42EES7_IiLi43EES7_IiLi44EES7_IiLi45EES7_IiLi46EES7_IiLi47EES7_IiLi48EES7_IiLi49EES7_IiLi50EES7_IiLi51EES7_IiLi52EES7_IiLi53EES7_IiLi54EES7_IiLi55EES7_IiLi56EES7_IiLi57EES7_IiLi58EES7_IiLi59EES7_IiLi60EES7_IiLi61EES7_IiLi62EES7_IiLi63EEEEEE9functionsE, 512
+_ZN6simple7support6detail11apply_tableISt16integer_sequenceImJLm0ELm1ELm2ELm3ELm4ELm5ELm6ELm7ELm8ELm9ELm10ELm11ELm12ELm13ELm14ELm15ELm16ELm17ELm18ELm19ELm20ELm21ELm22ELm23ELm24ELm25ELm26ELm27ELm28ELm29ELm30ELm31ELm32ELm33ELm34ELm35ELm36ELm37ELm38ELm39ELm40ELm41ELm42ELm43ELm44ELm45ELm46ELm47ELm48ELm49ELm50ELm51ELm52ELm53ELm54ELm55ELm56ELm57ELm58ELm59ELm60ELm61ELm62ELm63EEE5valueJSt5tupleIJSt17integral_constantIiLi0EES7_IiLi1EES7_IiLi2EES7_IiLi3EES7_IiLi4EES7_IiLi5EES7_IiLi6EES7_IiLi7EES7_IiLi8EES7_IiLi9EES7_IiLi10EES7_IiLi11EES7_IiLi12EES7_IiLi13EES7_IiLi14EES7_IiLi15EES7_IiLi16EES7_IiLi17EES7_IiLi18EES7_IiLi19EES7_IiLi20EES7_IiLi21EES7_IiLi22EES7_IiLi23EES7_IiLi24EES7_IiLi25EES7_IiLi26EES7_IiLi27EES7_IiLi28EES7_IiLi29EES7_IiLi30EES7_IiLi31EES7_IiLi32EES7_IiLi33EES7_IiLi34EES7_IiLi35EES7_IiLi36EES7_IiLi37EES7_IiLi38EES7_IiLi39EES7_IiLi40EES7_IiLi41EES7_IiLi42EES7_IiLi43EES7_IiLi44EES7_IiLi45EES7_IiLi46EES7_IiLi47EES7_IiLi48EES7_IiLi49EES7_IiLi50EES7_IiLi51EES7_IiLi52EES7_IiLi53EES7_IiLi54EES7_IiLi55EES7_IiLi56EES7_IiLi57EES7_IiLi58EES7_IiLi59EES7_IiLi60EES7_IiLi61EES7_IiLi62EES7_IiLi63EEEEEE9functionsE:
+	.quad	_ZN6simple7support6detail8apply_atILm0E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm1E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm2E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm3E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm4E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm5E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm6E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm7E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm8E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm9E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm10E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm11E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm12E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm13E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm14E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm15E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm16E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm17E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm18E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm19E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm20E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm21E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm22E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm23E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm24E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm25E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm26E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm27E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm28E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm29E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm30E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm31E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm32E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm33E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm34E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm35E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm36E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm37E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm38E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm39E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm40E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm41E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm42E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm43E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm44E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm45E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm46E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm47E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm48E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm49E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm50E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm51E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm52E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm53E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm54E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm55E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm56E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm57E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm58E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm59E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm60E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm61E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm62E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm63E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EES5_IiLi16EES5_IiLi17EES5_IiLi18EES5_IiLi19EES5_IiLi20EES5_IiLi21EES5_IiLi22EES5_IiLi23EES5_IiLi24EES5_IiLi25EES5_IiLi26EES5_IiLi27EES5_IiLi28EES5_IiLi29EES5_IiLi30EES5_IiLi31EES5_IiLi32EES5_IiLi33EES5_IiLi34EES5_IiLi35EES5_IiLi36EES5_IiLi37EES5_IiLi38EES5_IiLi39EES5_IiLi40EES5_IiLi41EES5_IiLi42EES5_IiLi43EES5_IiLi44EES5_IiLi45EES5_IiLi46EES5_IiLi47EES5_IiLi48EES5_IiLi49EES5_IiLi50EES5_IiLi51EES5_IiLi52EES5_IiLi53EES5_IiLi54EES5_IiLi55EES5_IiLi56EES5_IiLi57EES5_IiLi58EES5_IiLi59EES5_IiLi60EES5_IiLi61EES5_IiLi62EES5_IiLi63EEEEEEEDcOT0_DpOT1_
+	.weak	_ZN6simple7support6detail11apply_tableISt16integer_sequenceImJLm0ELm1ELm2ELm3ELm4ELm5ELm6ELm7ELm8ELm9ELm10ELm11ELm12ELm13ELm14ELm15EEE5valueJSt5tupleIJSt17integral_constantIiLi0EES7_IiLi1EES7_IiLi2EES7_IiLi3EES7_IiLi4EES7_IiLi5EES7_IiLi6EES7_IiLi7EES7_IiLi8EES7_IiLi9EES7_IiLi10EES7_IiLi11EES7_IiLi12EES7_IiLi13EES7_IiLi14EES7_IiLi15EEEEEE9functionsE
+	.section	.data.rel.ro.local._ZN6simple7support6detail11apply_tableISt16integer_sequenceImJLm0ELm1ELm2ELm3ELm4ELm5ELm6ELm7ELm8ELm9ELm10ELm11ELm12ELm13ELm14ELm15EEE5valueJSt5tupleIJSt17integral_constantIiLi0EES7_IiLi1EES7_IiLi2EES7_IiLi3EES7_IiLi4EES7_IiLi5EES7_IiLi6EES7_IiLi7EES7_IiLi8EES7_IiLi9EES7_IiLi10EES7_IiLi11EES7_IiLi12EES7_IiLi13EES7_IiLi14EES7_IiLi15EEEEEE9functionsE,"awG",@progbits,_ZN6simple7support6detail11apply_tableISt16integer_sequenceImJLm0ELm1ELm2ELm3ELm4ELm5ELm6ELm7ELm8ELm9ELm10ELm11ELm12ELm13ELm14ELm15EEE5valueJSt5tupleIJSt17integral_constantIiLi0EES7_IiLi1EES7_IiLi2EES7_IiLi3EES7_IiLi4EES7_IiLi5EES7_IiLi6EES7_IiLi7EES7_IiLi8EES7_IiLi9EES7_IiLi10EES7_IiLi11EES7_IiLi12EES7_IiLi13EES7_IiLi14EES7_IiLi15EEEEEE9functionsE,comdat
+	.align 32
+	.type	_ZN6simple7support6detail11apply_tableISt16integer_sequenceImJLm0ELm1ELm2ELm3ELm4ELm5ELm6ELm7ELm8ELm9ELm10ELm11ELm12ELm13ELm14ELm15EEE5valueJSt5tupleIJSt17integral_constantIiLi0EES7_IiLi1EES7_IiLi2EES7_IiLi3EES7_IiLi4EES7_IiLi5EES7_IiLi6EES7_IiLi7EES7_IiLi8EES7_IiLi9EES7_IiLi10EES7_IiLi11EES7_IiLi12EES7_IiLi13EES7_IiLi14EES7_IiLi15EEEEEE9functionsE, @gnu_unique_object
+	.size	_ZN6simple7support6detail11apply_tableISt16integer_sequenceImJLm0ELm1ELm2ELm3ELm4ELm5ELm6ELm7ELm8ELm9ELm10ELm11ELm12ELm13ELm14ELm15EEE5valueJSt5tupleIJSt17integral_constantIiLi0EES7_IiLi1EES7_IiLi2EES7_IiLi3EES7_IiLi4EES7_IiLi5EES7_IiLi6EES7_IiLi7EES7_IiLi8EES7_IiLi9EES7_IiLi10EES7_IiLi11EES7_IiLi12EES7_IiLi13EES7_IiLi14EES7_IiLi15EEEEEE9functionsE, 128
+_ZN6simple7support6detail11apply_tableISt16integer_sequenceImJLm0ELm1ELm2ELm3ELm4ELm5ELm6ELm7ELm8ELm9ELm10ELm11ELm12ELm13ELm14ELm15EEE5valueJSt5tupleIJSt17integral_constantIiLi0EES7_IiLi1EES7_IiLi2EES7_IiLi3EES7_IiLi4EES7_IiLi5EES7_IiLi6EES7_IiLi7EES7_IiLi8EES7_IiLi9EES7_IiLi10EES7_IiLi11EES7_IiLi12EES7_IiLi13EES7_IiLi14EES7_IiLi15EEEEEE9functionsE:
+	.quad	_ZN6simple7support6detail8apply_atILm0E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm1E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm2E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm3E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm4E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm5E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm6E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm7E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm8E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm9E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm10E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm11E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm12E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm13E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm14E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.quad	_ZN6simple7support6detail8apply_atILm15E5valueJSt5tupleIJSt17integral_constantIiLi0EES5_IiLi1EES5_IiLi2EES5_IiLi3EES5_IiLi4EES5_IiLi5EES5_IiLi6EES5_IiLi7EES5_IiLi8EES5_IiLi9EES5_IiLi10EES5_IiLi11EES5_IiLi12EES5_IiLi13EES5_IiLi14EES5_IiLi15EEEEEEEDcOT0_DpOT1_
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
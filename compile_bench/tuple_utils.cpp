@@ -0,0 +1,58 @@
+// Not a test, but a compile time benchmark of the tuple meta-programming utilities.
+// Each is instantiated on tuples of SIMPLE_COMPILE_BENCH_SIZE elements,
+// which has to compile under a template depth limit well below that.
+#include <cstddef>
+#include <type_traits>
+#include "simple/support/tuple_utils.hpp"
+#include "simple/support/carcdr.hpp"
+
+using namespace simple::support;
+
+#ifndef SIMPLE_COMPILE_BENCH_SIZE
+#define SIMPLE_COMPILE_BENCH_SIZE 1024
+#endif
+
+constexpr std::size_t size = SIMPLE_COMPILE_BENCH_SIZE;
+constexpr std::size_t last = size - 1;
+
+template <std::size_t I>
+using index = std::integral_constant<std::size_t, I>;
+
+template <std::size_t... I>
+auto make_tuple_of_indices(std::index_sequence<I...>) -> std::tuple<index<I>...>;
+using indices = std::make_index_sequence<size>;
+using tuple = decltype(make_tuple_of_indices(indices{}));
+
+template <std::size_t... I>
+auto make_nested_tuple(std::index_sequence<I...>) -> std::tuple<std::tuple<index<I>, index<I>>...>;
+using nested = decltype(make_nested_tuple(indices{}));
+
+template <typename T>
+struct is_last : std::bool_constant<T::value == last> {};
+
+static_assert(find_v<index<last>, tuple> == last);
+static_assert(find_v<index<0>, tuple, 1> == size);
+static_assert(find_if_v<is_last, tuple> == last);
+static_assert(find_if_t<is_last, tuple>::value == last);
+
+static_assert(std::tuple_size_v<flatten_t<tuple>> == size);
+static_assert(std::tuple_size_v<flatten_t<nested>> == size * 2);
+static_assert(std::is_same_v<
+	subtuple_t<flatten_t<nested>, std::index_sequence<size * 2 - 1>>,
+	std::tuple<index<last>>
+>);
+
+static_assert(std::is_same_v<
+	subtuple_t<tuple, std::index_sequence<last, 0>>,
+	std::tuple<index<last>, index<0>>
+>);
+static_assert(std::tuple_size_v<tuple_cdr_t<tuple>> == last);
+static_assert(std::is_same_v<tuple_car_t<tuple>, index<0>>);
+
+static_assert(car<indices, last> == last);
+static_assert(car<indices, size, size> == size);
+
+static_assert(std::is_same_v<
+	subtuple_t<overlap_t<std::tuple<void>, tuple>, std::index_sequence<0, last>>,
+	std::tuple<void, index<last>>
+>);
@@ -4,16 +4,24 @@
 #include "support/array_operators.hpp"
 #include "support/array_utils.hpp"
 #include "support/bits.hpp"
+#include "support/bitmap.hpp"
 #include "support/carcdr.hpp"
 #include "support/enum_flags_operators.hpp"
 #include "support/enum.hpp"
+#include "support/enum_map.hpp"
+#include "support/fixed_point.hpp"
+#include "support/format.hpp"
 #include "support/function_utils.hpp"
+#include "support/heterogeneous_vector.hpp"
 #include "support/int_literals.hpp"
 #include "support/logic.hpp"
 #include "support/math.hpp"
 #include "support/misc.hpp"
+#include "support/overflow.hpp"
 #include "support/random.hpp"
+#include "support/roaring.hpp"
 #include "support/range.hpp"
 #include "support/rational.hpp"
 #include "support/tuple_utils.hpp"
 #include "support/type_traits.hpp"
+#include "support/wide_int.hpp"
@@ -1,13 +1,25 @@
 #ifndef SIMPLE_SUPPORT_ALGORITHM_NUMERIC_HPP
 #define SIMPLE_SUPPORT_ALGORITHM_NUMERIC_HPP
 #include <cmath>
+#include <cassert>
+#include <climits>
+#include <cstdint>
 #include <type_traits>
 
 #include "../arithmetic.hpp"
+#include "../math/fastdiv.hpp"
+#include "../type_traits.hpp"
+#include "traits.hpp"
 
 namespace simple::support
 {
 
+	// only needed for the overloads below,
+	// whoever passes one in has the full definition
+	template <typename Tp, std::size_t Nm> struct array;
+	// rational.hpp also has the scalar way and wayback for it
+	template <typename Num, typename Denom> class rational;
+
 	template <typename Number,
 		std::enable_if_t<!std::is_floating_point_v<Number>>* = nullptr>
 	[[nodiscard]] constexpr
@@ -26,6 +38,71 @@ namespace simple::support
 		return std::fmod(x + upperLimit, upperLimit);
 	}
 
+	// same as wrap with a fixed upper limit, but for integers
+	// the division is precomputed into a multiplicative inverse,
+	// so every call is just a few multiplications
+	// (unless we don't have a wide enough integer to do that,
+	// then it's just wrap)
+	template <typename Number>
+	class wrapper
+	{
+		// need to match the promotions of wrap exactly, to get exactly the same results
+		using promoted = decltype(std::declval<Number>() + std::declval<Number>());
+		static constexpr bool fast = detail::has_fastdiv_v<promoted>;
+
+		Number upperLimit;
+		std::conditional_t<fast, detail::fastdiv<promoted>, std::nullptr_t> div;
+
+		public:
+		constexpr explicit wrapper(Number upperLimit) :
+			upperLimit(upperLimit),
+			div(make_div(upperLimit))
+		{
+			assert(upperLimit != Number{});
+		}
+
+		[[nodiscard]]
+		constexpr const Number& limit() const noexcept
+		{ return upperLimit; }
+
+		[[nodiscard]] constexpr
+		Number operator()(Number x) const
+		noexcept(fast || noexcept(wrap(x, upperLimit)))
+		{
+			if constexpr (fast)
+				// the sum overflows same as in wrap
+				return static_cast<Number>(div.remainder(x + upperLimit));
+			else
+				return wrap(x, upperLimit);
+		}
+
+		template <typename It, typename OutIt>
+		constexpr OutIt operator()(It begin, It end, OutIt out) const
+		{
+			while(begin != end)
+				*out++ = (*this)(*begin++);
+			return out;
+		}
+
+		template <typename Range, typename OutIt,
+			std::enable_if_t<is_range_v<Range>>* = nullptr>
+		constexpr OutIt operator()(const Range& range, OutIt out) const
+		{
+			using std::begin;
+			using std::end;
+			return (*this)(begin(range), end(range), out);
+		}
+
+		private:
+		static constexpr auto make_div(Number upperLimit)
+		{
+			if constexpr (fast)
+				return detail::fastdiv<promoted>(upperLimit);
+			else
+				return nullptr;
+		}
+	};
+
 	template <typename... Numbers>
 	[[nodiscard]] constexpr
 	auto average(Numbers... n)
@@ -70,6 +147,251 @@ namespace simple::support
 		return from - (from - to)/2;
 	}
 
+	namespace detail
+	{
+
+		template <typename Number> constexpr bool fast_fma = false;
+#if defined FP_FAST_FMAF
+		template <> constexpr bool fast_fma<float> = true;
+#endif
+#if defined FP_FAST_FMA
+		template <> constexpr bool fast_fma<double> = true;
+#endif
+#if defined FP_FAST_FMAL
+		template <> constexpr bool fast_fma<long double> = true;
+#endif
+
+		// only if the hardware can do it,
+		// otherwise std::fma is a slow software emulation
+		template <typename Number>
+		constexpr Number multiply_add(Number a, Number b, Number c)
+		{
+			if constexpr (fast_fma<Number>)
+				return std::fma(a, b, c);
+			else
+				return a * b + c;
+		}
+
+		template <typename Number, typename Ratio>
+		constexpr bool fma_way = std::is_floating_point_v<Number> && std::is_arithmetic_v<Ratio>;
+
+		template <typename Number, typename Ratio>
+		constexpr Number way_element(const Number& from, const Number& to, const Ratio& ratio)
+		{
+			if constexpr (fma_way<Number, Ratio>)
+				return multiply_add<Number>(to - from, ratio, from);
+			else
+				return way(from, to, ratio);
+		}
+
+		template <typename Number, typename Ratio>
+		constexpr Number wayback_element(const Number& from, const Number& to, const Ratio& ratio)
+		{
+			if constexpr (fma_way<Number, Ratio>)
+				return multiply_add<Number>(from - to, -Number(ratio), from);
+			else
+				return wayback(from, to, ratio);
+		}
+
+		// a ratio prepared once to be used for a whole batch
+		template <typename Number, typename Ratio>
+		class way_kernel
+		{
+			Ratio ratio;
+			public:
+			constexpr explicit way_kernel(const Ratio& ratio) : ratio(ratio) {}
+			constexpr Number forward(const Number& from, const Number& to) const
+			{ return way_element(from, to, ratio); }
+			constexpr Number backward(const Number& from, const Number& to) const
+			{ return wayback_element(from, to, ratio); }
+		};
+
+		// for rationals the division is done once upfront,
+		// for floats that's just the ratio itself,
+		// for integers it's a precomputed division by the denominator,
+		// unless it's known at compile time, then the compiler does that for us
+		template <typename Number, typename Num, typename Denom>
+		class way_kernel<Number, rational<Num, Denom>>
+		{
+			static constexpr bool floating = std::is_floating_point_v<Number>;
+			// a wider Number can't go through Num, that's left to the scalar way
+			static constexpr bool fast = not floating &&
+				std::is_void_v<Denom> && has_fastdiv_v<Num> &&
+				std::is_same_v<std::common_type_t<Number, Num>, Num>;
+
+			using ratio_t = rational<Num, Denom>;
+			using scale_t = std::conditional_t<floating, Number, Num>;
+			using divisor_t = std::conditional_t<fast, fastdiv<Num>, ratio_t>;
+
+			scale_t scale;
+			divisor_t divisor;
+
+			static constexpr scale_t make_scale(const ratio_t& ratio)
+			{
+				if constexpr (floating)
+					return Number(ratio.numerator()) / Number(ratio.denominator());
+				else
+					return ratio.numerator();
+			}
+
+			static constexpr divisor_t make_divisor(const ratio_t& ratio)
+			{
+				if constexpr (fast)
+					return fastdiv<Num>(ratio.denominator());
+				else
+					return ratio;
+			}
+
+			constexpr Num divide(Num x) const
+			{
+				if constexpr (fast)
+					return divisor.quotient(x);
+				else
+					return x / divisor.denominator();
+			}
+
+			public:
+			constexpr explicit way_kernel(const ratio_t& ratio) :
+				scale(make_scale(ratio)),
+				divisor(make_divisor(ratio))
+			{}
+
+			constexpr Number forward(const Number& from, const Number& to) const
+			{
+				if constexpr (floating)
+					return multiply_add<Number>(to - from, scale, from);
+				else if constexpr (fast)
+					return from + Number(divide(Num(to - from) * scale));
+				else
+					return way(from, to, divisor);
+			}
+
+			constexpr Number backward(const Number& from, const Number& to) const
+			{
+				if constexpr (floating)
+					return multiply_add<Number>(from - to, -scale, from);
+				else if constexpr (fast)
+					return from - Number(divide(Num(from - to) * scale));
+				else
+					return wayback(from, to, divisor);
+			}
+		};
+
+		template <typename Range>
+		using range_value_t = remove_cvref_t<decltype(*std::begin(std::declval<Range&>()))>;
+
+	} // namespace detail
+
+	// batched versions over ranges, ratio can be either a single value or a range of ratios per element
+
+	template <typename FromRange, typename ToRange, typename Ratio, typename OutIt,
+		std::enable_if_t<is_range_v<FromRange> && is_range_v<ToRange>>* = nullptr>
+	constexpr OutIt way(const FromRange& from, const ToRange& to, const Ratio& ratio, OutIt out)
+	{
+		using std::begin;
+		using std::end;
+		using Number = detail::range_value_t<const FromRange>;
+		auto from_it = begin(from);
+		auto to_it = begin(to);
+		if constexpr (is_range_v<Ratio>)
+		{
+			auto ratio_it = begin(ratio);
+			while(from_it != end(from))
+				*out++ = detail::way_element<Number>(*from_it++, *to_it++, *ratio_it++);
+		}
+		else
+		{
+			const auto kernel = detail::way_kernel<Number, Ratio>(ratio);
+			while(from_it != end(from))
+				*out++ = kernel.forward(*from_it++, *to_it++);
+		}
+		return out;
+	}
+
+	template <typename FromRange, typename ToRange, typename Ratio, typename OutIt,
+		std::enable_if_t<is_range_v<FromRange> && is_range_v<ToRange>>* = nullptr>
+	constexpr OutIt wayback(const FromRange& from, const ToRange& to, const Ratio& ratio, OutIt out)
+	{
+		using std::begin;
+		using std::end;
+		using Number = detail::range_value_t<const FromRange>;
+		auto from_it = begin(from);
+		auto to_it = begin(to);
+		if constexpr (is_range_v<Ratio>)
+		{
+			auto ratio_it = begin(ratio);
+			while(from_it != end(from))
+				*out++ = detail::wayback_element<Number>(*from_it++, *to_it++, *ratio_it++);
+		}
+		else
+		{
+			const auto kernel = detail::way_kernel<Number, Ratio>(ratio);
+			while(from_it != end(from))
+				*out++ = kernel.backward(*from_it++, *to_it++);
+		}
+		return out;
+	}
+
+	template <typename FromRange, typename ToRange, typename OutIt,
+		std::enable_if_t<is_range_v<FromRange> && is_range_v<ToRange>>* = nullptr>
+	constexpr OutIt halfway(const FromRange& from, const ToRange& to, OutIt out)
+	{
+		using std::begin;
+		using std::end;
+		auto to_it = begin(to);
+		for(auto from_it = begin(from); from_it != end(from); ++from_it, ++to_it)
+			*out++ = halfway(*from_it, *to_it);
+		return out;
+	}
+
+	template <typename FromRange, typename ToRange, typename OutIt,
+		std::enable_if_t<is_range_v<FromRange> && is_range_v<ToRange>>* = nullptr>
+	constexpr OutIt halfwayback(const FromRange& from, const ToRange& to, OutIt out)
+	{
+		using std::begin;
+		using std::end;
+		auto to_it = begin(to);
+		for(auto from_it = begin(from); from_it != end(from); ++from_it, ++to_it)
+			*out++ = halfwayback(*from_it, *to_it);
+		return out;
+	}
+
+	template <typename Number, std::size_t Size, typename Ratio>
+	[[nodiscard]] constexpr
+	array<Number, Size> way(const array<Number, Size>& from, const array<Number, Size>& to, const Ratio& ratio)
+	{
+		array<Number, Size> result{};
+		way(from, to, ratio, result.begin());
+		return result;
+	}
+
+	template <typename Number, std::size_t Size, typename Ratio>
+	[[nodiscard]] constexpr
+	array<Number, Size> wayback(const array<Number, Size>& from, const array<Number, Size>& to, const Ratio& ratio)
+	{
+		array<Number, Size> result{};
+		wayback(from, to, ratio, result.begin());
+		return result;
+	}
+
+	template <typename Number, std::size_t Size>
+	[[nodiscard]] constexpr
+	array<Number, Size> halfway(const array<Number, Size>& from, const array<Number, Size>& to)
+	{
+		array<Number, Size> result{};
+		halfway(from, to, result.begin());
+		return result;
+	}
+
+	template <typename Number, std::size_t Size>
+	[[nodiscard]] constexpr
+	array<Number, Size> halfwayback(const array<Number, Size>& from, const array<Number, Size>& to)
+	{
+		array<Number, Size> result{};
+		halfwayback(from, to, result.begin());
+		return result;
+	}
+
 	template <typename Integer,
 		typename Unsigned = std::make_unsigned_t<Integer>>
 	[[nodiscard]] constexpr
@@ -67,7 +67,10 @@ namespace simple { namespace support
 	template<typename Int, enable_if_overflow_defined<Int>* = nullptr>
 	constexpr inline bool slow_mul_overflow(Int& result, Int one, Int two)
 	{
-		result = one * two;
+		// small unsigned types get promoted to int, which can overflow
+		using wide = std::conditional_t<std::is_unsigned_v<Int>,
+			std::common_type_t<Int, unsigned>, Int>;
+		result = Int(wide(one) * wide(two));
 		return (two != 0 && result / two != one);
 	}
 
@@ -0,0 +1,261 @@
+#ifndef SIMPLE_SUPPORT_BITMAP_HPP
+#define SIMPLE_SUPPORT_BITMAP_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <new>
+
+#include "bits.hpp"
+
+namespace simple::support
+{
+
+	namespace detail
+	{
+
+		template <typename T, std::size_t Alignment>
+		struct aligned_allocator
+		{
+			using value_type = T;
+			template <typename U>
+			struct rebind { using other = aligned_allocator<U, Alignment>; };
+
+			aligned_allocator() = default;
+			template <typename U>
+			constexpr aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept {}
+
+			[[nodiscard]] T* allocate(std::size_t n)
+			{
+				return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+			}
+
+			void deallocate(T* p, std::size_t) noexcept
+			{
+				::operator delete(p, std::align_val_t{Alignment});
+			}
+
+			template <typename U>
+			constexpr bool operator==(const aligned_allocator<U, Alignment>&) const noexcept { return true; }
+			template <typename U>
+			constexpr bool operator!=(const aligned_allocator<U, Alignment>&) const noexcept { return false; }
+		};
+
+	} // namespace detail
+
+	// runtime sized bitmap, stored in cache line sized blocks,
+	// with an index of set bits counts for rank and select queries
+	// the index needs to be updated explicitly after modifications
+	class bitmap
+	{
+		public:
+		using word = std::uint64_t;
+		static constexpr std::size_t word_bits = std::numeric_limits<word>::digits;
+		static constexpr std::size_t block_words = 8;
+		static constexpr std::size_t block_bits = block_words * word_bits;
+		// one in this many set bits remembers its block, to narrow down the search for select
+		static constexpr std::size_t select_sample = 8192;
+
+		bitmap() = default;
+
+		explicit bitmap(std::size_t size, bool value = false)
+		{
+			resize(size, value);
+		}
+
+		[[nodiscard]] std::size_t size() const noexcept { return bit_size; }
+		[[nodiscard]] bool empty() const noexcept { return bit_size == 0; }
+
+		[[nodiscard]] const word* data() const noexcept { return words.data(); }
+		[[nodiscard]] std::size_t word_count() const noexcept
+		{ return (bit_size + word_bits - 1) / word_bits; }
+
+		[[nodiscard]] bool operator[](std::size_t position) const noexcept
+		{
+			assert(position < bit_size);
+			return (word_at(position) >> (position % word_bits)) & 1;
+		}
+
+		void set(std::size_t position) noexcept
+		{
+			assert(position < bit_size);
+			word_at(position) |= word{1} << (position % word_bits);
+			indexed = false;
+		}
+
+		void reset(std::size_t position) noexcept
+		{
+			assert(position < bit_size);
+			word_at(position) &= ~(word{1} << (position % word_bits));
+			indexed = false;
+		}
+
+		void set(std::size_t position, bool value) noexcept
+		{
+			if(value)
+				set(position);
+			else
+				reset(position);
+		}
+
+		void flip(std::size_t position) noexcept
+		{
+			assert(position < bit_size);
+			word_at(position) ^= word{1} << (position % word_bits);
+			indexed = false;
+		}
+
+		void resize(std::size_t size, bool value = false)
+		{
+			const std::size_t old_size = bit_size;
+			words.resize((size + block_bits - 1) / block_bits * block_words);
+			bit_size = size;
+			if(value && size > old_size)
+			{
+				// finish the partial word, then fill whole ones
+				for(std::size_t i = old_size; i < size && i % word_bits != 0; ++i)
+					set(i);
+				for(std::size_t i = (old_size + word_bits - 1) / word_bits; i < word_count(); ++i)
+					words[i] = ~word{};
+			}
+			clear_tail();
+			indexed = false;
+		}
+
+		// number of set bits
+		[[nodiscard]] std::size_t count() const noexcept
+		{
+			return indexed ? ranks.back() : count_ones(data(), data() + word_count());
+		}
+
+		// rebuilds the counts used by rank and select
+		void update_index()
+		{
+			const std::size_t blocks = words.size() / block_words;
+			ranks.resize(blocks + 1);
+			select_samples.clear();
+			std::size_t ones = 0;
+			for(std::size_t i = 0; i < blocks; ++i)
+			{
+				ranks[i] = ones;
+				const std::size_t block_ones = count_ones(
+					words.data() + i * block_words, words.data() + (i + 1) * block_words);
+				// record the block for each sample that falls in it
+				while(select_samples.size() * select_sample < ones + block_ones)
+					select_samples.push_back(i);
+				ones += block_ones;
+			}
+			ranks.back() = ones;
+			indexed = true;
+		}
+
+		[[nodiscard]] bool index_valid() const noexcept { return indexed; }
+
+		// number of set bits before the position
+		[[nodiscard]] std::size_t rank(std::size_t position) const noexcept
+		{
+			assert(indexed && "Index must be updated.");
+			assert(position <= bit_size);
+			const std::size_t block = position / block_bits;
+			if(block == ranks.size() - 1)
+				return ranks.back();
+			const std::size_t word_index = position / word_bits;
+			std::size_t result = ranks[block];
+			for(std::size_t i = block * block_words; i < word_index; ++i)
+				result += count_ones(words[i]);
+			const std::size_t bit = position % word_bits;
+			if(bit != 0)
+				result += count_ones(words[word_index] << (word_bits - bit));
+			return result;
+		}
+
+		// position of the nth (counting from 0) set bit, or size if there isn't one
+		[[nodiscard]] std::size_t select(std::size_t n) const noexcept
+		{
+			assert(indexed && "Index must be updated.");
+			if(n >= ranks.back())
+				return bit_size;
+
+			// samples bound the block, the rest is binary search on ranks
+			const std::size_t sample = n / select_sample;
+			const auto first = ranks.begin() + select_samples[sample];
+			const auto last = sample + 1 < select_samples.size()
+				? ranks.begin() + select_samples[sample + 1] + 1
+				: ranks.end() - 1;
+			const auto block = std::upper_bound(first, last, n) - 1;
+
+			std::size_t remaining = n - *block;
+			for(std::size_t i = (block - ranks.begin()) * block_words; ; ++i)
+			{
+				const std::size_t ones = count_ones(words[i]);
+				if(remaining < ones)
+					return i * word_bits + nth_set_bit(words[i], int(remaining));
+				remaining -= ones;
+			}
+		}
+
+		// positions of all set bits in order
+		[[nodiscard]] set_bit_range<const word*> set_bits() const noexcept
+		{
+			return support::set_bits(data(), data() + word_count());
+		}
+
+		// bitwise operations between bitmaps of the same size
+		bitmap& operator&=(const bitmap& other) noexcept
+		{ return combine(other, [](word a, word b) { return a & b; }); }
+
+		bitmap& operator|=(const bitmap& other) noexcept
+		{ return combine(other, [](word a, word b) { return a | b; }); }
+
+		bitmap& operator^=(const bitmap& other) noexcept
+		{ return combine(other, [](word a, word b) { return a ^ b; }); }
+
+		[[nodiscard]] bool operator==(const bitmap& other) const noexcept
+		{
+			return bit_size == other.bit_size &&
+				std::equal(data(), data() + word_count(), other.data());
+		}
+
+		[[nodiscard]] bool operator!=(const bitmap& other) const noexcept
+		{ return !(*this == other); }
+
+		private:
+		// always a whole number of blocks, each one aligned to a cache line
+		std::vector<word, detail::aligned_allocator<word, block_words * sizeof(word)>> words;
+		std::size_t bit_size = 0;
+		std::vector<std::size_t> ranks;
+		std::vector<std::size_t> select_samples;
+		bool indexed = false;
+
+		word& word_at(std::size_t position) noexcept
+		{ return words[position / word_bits]; }
+		const word& word_at(std::size_t position) const noexcept
+		{ return words[position / word_bits]; }
+
+		// bits past the size are kept at zero, so that counts don't need to mask them
+		void clear_tail() noexcept
+		{
+			const std::size_t used = bit_size % word_bits;
+			if(used != 0)
+				word_at(bit_size) &= ~word{} >> (word_bits - used);
+			std::fill(words.begin() + word_count(), words.end(), word{});
+		}
+
+		template <typename Op>
+		bitmap& combine(const bitmap& other, Op op) noexcept
+		{
+			assert(bit_size == other.bit_size);
+			for(std::size_t i = 0; i < word_count(); ++i)
+				words[i] = op(words[i], other.words[i]);
+			clear_tail();
+			indexed = false;
+			return *this;
+		}
+	};
+
+} // namespace simple::support
+
+#endif /* end of include guard */
@@ -4,24 +4,118 @@
 #include <type_traits>
 #include <cassert>
 #include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <iterator>
+
+#include "algorithm/traits.hpp"
 
 #if !defined __GNUC__
 #define SIMPLE_SUPPORT_BITS_DISABLE_INTRINSICS
 #endif
 
-#if defined SIMPLE_SUPPORT_BITS_DISABLE_INTRINSICS
-#include <bitset>
+// pdep/pext instructions can't be used in constant expressions,
+// so need to know when we are in one
+#if !defined SIMPLE_SUPPORT_BITS_DISABLE_INTRINSICS && defined __BMI2__ && defined __has_builtin
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define SIMPLE_SUPPORT_BITS_BMI2
+#include <immintrin.h>
+#endif
 #endif
 
 namespace simple { namespace support
 {
 
+	namespace detail
+	{
+
+		// for types that don't fit in 64 bits, work through 64 bit parts
+		template <typename Unsigned>
+		using swar_t = std::conditional_t<sizeof(Unsigned) <= sizeof(std::uint32_t),
+			std::uint32_t, std::uint64_t>;
+
+		// multiplying a power of 2 by a de Bruijn sequence
+		// puts a unique pattern in the high bits, for each power,
+		// that can be looked up in a table
+		template <typename Unsigned>
+		struct de_bruijn_table
+		{
+			static constexpr int digits = std::numeric_limits<Unsigned>::digits;
+			static constexpr int shift = digits - (digits == 32 ? 5 : 6);
+			const Unsigned multiplier;
+			int positions[digits]{};
+
+			constexpr explicit de_bruijn_table(Unsigned multiplier) noexcept :
+				multiplier(multiplier)
+			{
+				for(int i = 0; i < digits; ++i)
+					positions[Unsigned(multiplier << i) >> shift] = i;
+			}
+
+			constexpr int operator()(Unsigned power_of_two) const noexcept
+			{
+				return positions[Unsigned(power_of_two * multiplier) >> shift];
+			}
+		};
+
+		template <typename Unsigned> struct de_bruijn;
+		template <> struct de_bruijn<std::uint32_t>
+		{ static constexpr de_bruijn_table<std::uint32_t> table{0x077c'b531u}; };
+		template <> struct de_bruijn<std::uint64_t>
+		{ static constexpr de_bruijn_table<std::uint64_t> table{0x03f7'9d71'b4cb'0a89u}; };
+
+		template <typename Unsigned>
+		constexpr int de_bruijn_count_trailing_zeros(Unsigned in) noexcept
+		{
+			using swar = swar_t<Unsigned>;
+			if constexpr (sizeof(Unsigned) <= sizeof(swar))
+			{
+				const auto x = static_cast<swar>(in);
+				return de_bruijn<swar>::table(swar(x & (swar{0} - x)));
+			}
+			else
+			{
+				constexpr int digits = std::numeric_limits<swar>::digits;
+				int count = 0;
+				for(; static_cast<swar>(in) == 0; in >>= digits)
+					count += digits;
+				return count + de_bruijn_count_trailing_zeros(static_cast<swar>(in));
+			}
+		}
+
+		// add up bits in parallel in pairs, then nibbles, then bytes,
+		// and multiplication sums up the bytes into the highest one
+		template <typename Unsigned>
+		constexpr int swar_count_ones(Unsigned in) noexcept
+		{
+			using swar = swar_t<Unsigned>;
+			if constexpr (sizeof(Unsigned) <= sizeof(swar))
+			{
+				constexpr swar ones = ~swar{};
+				auto x = static_cast<swar>(in);
+				x = x - ((x >> 1) & (ones / 3));
+				x = (x & (ones / 5)) + ((x >> 2) & (ones / 5));
+				x = (x + (x >> 4)) & (ones / 17);
+				return static_cast<int>(swar(x * (ones / 255)) >> (std::numeric_limits<swar>::digits - CHAR_BIT));
+			}
+			else
+			{
+				int count = 0;
+				for(; in != 0; in >>= std::numeric_limits<swar>::digits)
+					count += swar_count_ones(static_cast<swar>(in));
+				return count;
+			}
+		}
+
+	} // namespace detail
+
 	template <typename Int, std::enable_if_t<std::is_integral_v<Int>>* = nullptr>
 	constexpr int count_trailing_zeros(Int in) noexcept
 	{
 		assert(in && "Input must not be zero.");
-		constexpr auto size = sizeof(Int);
 #if !defined SIMPLE_SUPPORT_BITS_DISABLE_INTRINSICS
+		constexpr auto size = sizeof(Int);
 		if constexpr (size == sizeof(unsigned int))
 			return __builtin_ctz(in);
 		if constexpr (size == sizeof(unsigned long))
@@ -29,18 +123,15 @@ namespace simple { namespace support
 		else
 			return __builtin_ctzll(in);
 #else
-		const std::bitset<size * CHAR_BIT> bin(in);
-		int count = -1;
-		while(!bin[++count]);
-		return count;
+		return detail::de_bruijn_count_trailing_zeros(static_cast<std::make_unsigned_t<Int>>(in));
 #endif
 	}
 
 	template <typename Int, std::enable_if_t<std::is_integral_v<Int>>* = nullptr>
 	constexpr int count_ones(Int in) noexcept
 	{
-		constexpr auto size = sizeof(Int);
 #if !defined SIMPLE_SUPPORT_BITS_DISABLE_INTRINSICS
+		constexpr auto size = sizeof(Int);
 		if constexpr (size == sizeof(unsigned int))
 			return __builtin_popcount(in);
 		if constexpr (size == sizeof(unsigned long))
@@ -48,11 +139,7 @@ namespace simple { namespace support
 		else
 			return __builtin_popcountll(in);
 #else
-		const std::bitset<size * CHAR_BIT> bin(in);
-		int count = 0;
-		for(size_t i = 0; i < bin.size() ; ++i)
-			count += bin[i];
-		return count;
+		return detail::swar_count_ones(static_cast<std::make_unsigned_t<Int>>(in));
 #endif
 	}
 
@@ -62,6 +149,393 @@ namespace simple { namespace support
 		return sizeof(T) * CHAR_BIT;
 	}
 
+	template <typename Int, std::enable_if_t<std::is_integral_v<Int>>* = nullptr>
+	constexpr int count_leading_zeros(Int in) noexcept
+	{
+		assert(in && "Input must not be zero.");
+		using unsigned_t = std::make_unsigned_t<Int>;
+		constexpr int digits = std::numeric_limits<unsigned_t>::digits;
+		const auto bits = static_cast<unsigned_t>(in);
+#if !defined SIMPLE_SUPPORT_BITS_DISABLE_INTRINSICS
+		// smaller types get promoted, so need to discount the extra zeros
+		if constexpr (digits <= std::numeric_limits<unsigned int>::digits)
+			return __builtin_clz(bits) - (std::numeric_limits<unsigned int>::digits - digits);
+		else if constexpr (digits <= std::numeric_limits<unsigned long>::digits)
+			return __builtin_clzl(bits) - (std::numeric_limits<unsigned long>::digits - digits);
+		else
+			return __builtin_clzll(bits) - (std::numeric_limits<unsigned long long>::digits - digits);
+#else
+		// binary search for the highest set bit
+		int count = 0;
+		unsigned_t x = bits;
+		for(int shift = digits / 2; shift > 0; shift /= 2)
+		{
+			if(unsigned_t(x >> (digits - shift)) == 0)
+			{
+				x = unsigned_t(x << shift);
+				count += shift;
+			}
+		}
+		return count;
+#endif
+	}
+
+	// number of bits needed to represent the value, 0 for 0
+	template <typename Int, std::enable_if_t<std::is_integral_v<Int>>* = nullptr>
+	constexpr int bit_width(Int in) noexcept
+	{
+		using unsigned_t = std::make_unsigned_t<Int>;
+		return in == 0 ? 0 :
+			std::numeric_limits<unsigned_t>::digits - count_leading_zeros(in);
+	}
+
+	// smallest power of two not less than the value
+	template <typename Unsigned, std::enable_if_t<std::is_unsigned_v<Unsigned>>* = nullptr>
+	constexpr Unsigned next_power_of_two(Unsigned in) noexcept
+	{
+		if(in <= 1)
+			return 1;
+		const int width = bit_width(Unsigned(in - 1));
+		assert(width < std::numeric_limits<Unsigned>::digits && "Result must be representable.");
+		return Unsigned(Unsigned{1} << width);
+	}
+
+	// these usually get recognized and compiled to a single instruction
+	template <typename Unsigned, std::enable_if_t<std::is_unsigned_v<Unsigned>>* = nullptr>
+	constexpr Unsigned rotate_left(Unsigned in, int shift) noexcept
+	{
+		constexpr int digits = std::numeric_limits<Unsigned>::digits;
+		const unsigned left = unsigned(shift) % digits;
+		const unsigned right = (digits - left) % digits;
+		return Unsigned(Unsigned(in << left) | Unsigned(in >> right));
+	}
+
+	template <typename Unsigned, std::enable_if_t<std::is_unsigned_v<Unsigned>>* = nullptr>
+	constexpr Unsigned rotate_right(Unsigned in, int shift) noexcept
+	{
+		constexpr int digits = std::numeric_limits<Unsigned>::digits;
+		const unsigned right = unsigned(shift) % digits;
+		const unsigned left = (digits - right) % digits;
+		return Unsigned(Unsigned(in >> right) | Unsigned(in << left));
+	}
+
+	template <typename Int, std::enable_if_t<std::is_integral_v<Int>>* = nullptr>
+	constexpr Int byteswap(Int in) noexcept
+	{
+		using unsigned_t = std::make_unsigned_t<Int>;
+		constexpr auto size = sizeof(Int);
+		const auto bits = static_cast<unsigned_t>(in);
+#if !defined SIMPLE_SUPPORT_BITS_DISABLE_INTRINSICS
+		if constexpr (size == 1)
+			return in;
+		else if constexpr (size == sizeof(std::uint16_t))
+			return static_cast<Int>(__builtin_bswap16(bits));
+		else if constexpr (size == sizeof(std::uint32_t))
+			return static_cast<Int>(__builtin_bswap32(bits));
+		else if constexpr (size == sizeof(std::uint64_t))
+			return static_cast<Int>(__builtin_bswap64(bits));
+		else
+#endif
+		{
+			unsigned_t result = 0;
+			for(std::size_t i = 0; i < size; ++i)
+			{
+				result = unsigned_t(result << CHAR_BIT);
+				result |= unsigned_t(bits >> (i * CHAR_BIT)) & unsigned_t(UCHAR_MAX);
+			}
+			return static_cast<Int>(result);
+		}
+	}
+
+	// scatters the low bits of the value to the positions of set bits in the mask (pdep)
+	template <typename Unsigned, std::enable_if_t<std::is_unsigned_v<Unsigned>>* = nullptr>
+	constexpr Unsigned deposit_bits(Unsigned in, Unsigned mask) noexcept
+	{
+#if defined SIMPLE_SUPPORT_BITS_BMI2
+		if(!__builtin_is_constant_evaluated())
+		{
+			if constexpr (sizeof(Unsigned) <= sizeof(std::uint32_t))
+				return Unsigned(_pdep_u32(in, mask));
+#if defined __x86_64__
+			else if constexpr (sizeof(Unsigned) == sizeof(std::uint64_t))
+				return Unsigned(_pdep_u64(in, mask));
+#endif
+		}
+#endif
+		Unsigned result = 0;
+		for(Unsigned bit = 1; mask != 0; bit = Unsigned(bit << 1))
+		{
+			const Unsigned lowest = mask & Unsigned(-mask);
+			if(in & bit)
+				result |= lowest;
+			mask ^= lowest;
+		}
+		return result;
+	}
+
+	// gathers the bits of the value at the positions of set bits in the mask to the low bits (pext)
+	template <typename Unsigned, std::enable_if_t<std::is_unsigned_v<Unsigned>>* = nullptr>
+	constexpr Unsigned extract_bits(Unsigned in, Unsigned mask) noexcept
+	{
+#if defined SIMPLE_SUPPORT_BITS_BMI2
+		if(!__builtin_is_constant_evaluated())
+		{
+			if constexpr (sizeof(Unsigned) <= sizeof(std::uint32_t))
+				return Unsigned(_pext_u32(in, mask));
+#if defined __x86_64__
+			else if constexpr (sizeof(Unsigned) == sizeof(std::uint64_t))
+				return Unsigned(_pext_u64(in, mask));
+#endif
+		}
+#endif
+		Unsigned result = 0;
+		for(Unsigned bit = 1; mask != 0; bit = Unsigned(bit << 1))
+		{
+			const Unsigned lowest = mask & Unsigned(-mask);
+			if(in & lowest)
+				result |= bit;
+			mask ^= lowest;
+		}
+		return result;
+	}
+
+	// position of the nth (counting from 0) set bit
+	template <typename Unsigned, std::enable_if_t<std::is_unsigned_v<Unsigned>>* = nullptr>
+	constexpr int nth_set_bit(Unsigned in, int n) noexcept
+	{
+		assert(n < count_ones(in) && "Not enough bits set.");
+#if defined SIMPLE_SUPPORT_BITS_BMI2
+		if(!__builtin_is_constant_evaluated())
+			return count_trailing_zeros(deposit_bits(Unsigned(Unsigned{1} << n), in));
+#endif
+		for(; n > 0; --n)
+			in &= Unsigned(in - 1);
+		return count_trailing_zeros(in);
+	}
+
+	namespace detail
+	{
+
+		template <typename Word>
+		constexpr void carry_save_add(Word& high, Word& low, Word a, Word b, Word c) noexcept
+		{
+			const Word u = a ^ b;
+			high = (a & b) | (u & c);
+			low = u ^ c;
+		}
+
+		// Harley-Seal: add up words bitwise with carry save adders,
+		// so that we only need to count the ones of one in 16 words,
+		// plain bitwise operations that the compiler can vectorize
+		template <typename Word, typename Get>
+		constexpr std::size_t harley_seal_count(std::size_t size, Get get) noexcept
+		{
+			Word ones = 0, twos = 0, fours = 0, eights = 0;
+			std::size_t total = 0;
+			std::size_t i = 0;
+			for(; size - i >= 16; i += 16)
+			{
+				Word twos_a{}, twos_b{}, fours_a{}, fours_b{}, eights_a{}, eights_b{}, sixteens{};
+				carry_save_add(twos_a, ones, ones, get(i + 0), get(i + 1));
+				carry_save_add(twos_b, ones, ones, get(i + 2), get(i + 3));
+				carry_save_add(fours_a, twos, twos, twos_a, twos_b);
+				carry_save_add(twos_a, ones, ones, get(i + 4), get(i + 5));
+				carry_save_add(twos_b, ones, ones, get(i + 6), get(i + 7));
+				carry_save_add(fours_b, twos, twos, twos_a, twos_b);
+				carry_save_add(eights_a, fours, fours, fours_a, fours_b);
+				carry_save_add(twos_a, ones, ones, get(i + 8), get(i + 9));
+				carry_save_add(twos_b, ones, ones, get(i + 10), get(i + 11));
+				carry_save_add(fours_a, twos, twos, twos_a, twos_b);
+				carry_save_add(twos_a, ones, ones, get(i + 12), get(i + 13));
+				carry_save_add(twos_b, ones, ones, get(i + 14), get(i + 15));
+				carry_save_add(fours_b, twos, twos, twos_a, twos_b);
+				carry_save_add(eights_b, fours, fours, fours_a, fours_b);
+				carry_save_add(sixteens, eights, eights, eights_a, eights_b);
+				total += count_ones(sixteens);
+			}
+			total = 16 * total
+				+ 8 * count_ones(eights)
+				+ 4 * count_ones(fours)
+				+ 2 * count_ones(twos)
+				+ count_ones(ones);
+			for(; i < size; ++i)
+				total += count_ones(get(i));
+			return total;
+		}
+
+		template <typename It>
+		using word_t = std::make_unsigned_t<typename std::iterator_traits<It>::value_type>;
+
+	} // namespace detail
+
+	template <typename It, std::enable_if_t<not std::is_integral_v<It>>* = nullptr>
+	constexpr std::size_t count_ones(It begin, It end) noexcept
+	{
+		using word = detail::word_t<It>;
+		return detail::harley_seal_count<word>(end - begin,
+			[begin](std::size_t i) { return word(begin[i]); });
+	}
+
+	template <typename Range, std::enable_if_t<is_range_v<Range>>* = nullptr>
+	constexpr std::size_t count_ones(const Range& range) noexcept
+	{
+		using std::begin;
+		using std::end;
+		return count_ones(begin(range), end(range));
+	}
+
+	// these count the ones of bitwise combination of two spans without storing it
+	template <typename It, typename OtherIt>
+	constexpr std::size_t count_ones_and(It begin, It end, OtherIt other) noexcept
+	{
+		using word = detail::word_t<It>;
+		return detail::harley_seal_count<word>(end - begin,
+			[begin, other](std::size_t i) { return word(word(begin[i]) & word(other[i])); });
+	}
+
+	template <typename It, typename OtherIt>
+	constexpr std::size_t count_ones_or(It begin, It end, OtherIt other) noexcept
+	{
+		using word = detail::word_t<It>;
+		return detail::harley_seal_count<word>(end - begin,
+			[begin, other](std::size_t i) { return word(word(begin[i]) | word(other[i])); });
+	}
+
+	template <typename It, typename OtherIt>
+	constexpr std::size_t count_ones_xor(It begin, It end, OtherIt other) noexcept
+	{
+		using word = detail::word_t<It>;
+		return detail::harley_seal_count<word>(end - begin,
+			[begin, other](std::size_t i) { return word(word(begin[i]) ^ word(other[i])); });
+	}
+
+	// index of the lowest set bit in a span of words, counting from the first word,
+	// or the total number of bits if there are none
+	template <typename It>
+	constexpr std::size_t find_first_set(It begin, It end) noexcept
+	{
+		constexpr std::size_t digits = std::numeric_limits<detail::word_t<It>>::digits;
+		std::size_t index = 0;
+		for(; begin != end; ++begin, index += digits)
+			if(*begin != 0)
+				return index + count_trailing_zeros(*begin);
+		return index;
+	}
+
+	template <typename Range, std::enable_if_t<is_range_v<Range>>* = nullptr>
+	constexpr std::size_t find_first_set(const Range& range) noexcept
+	{
+		using std::begin;
+		using std::end;
+		return find_first_set(begin(range), end(range));
+	}
+
+	// iterates over the positions of set bits in a span of words,
+	// finding the lowest with count_trailing_zeros and clearing it each step
+	template <typename WordIt>
+	class set_bit_iterator
+	{
+		public:
+		using word = detail::word_t<WordIt>;
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const std::size_t*;
+		using reference = std::size_t;
+
+		constexpr set_bit_iterator() = default;
+
+		constexpr set_bit_iterator(WordIt begin, WordIt end) noexcept :
+			current(begin), last(end)
+		{
+			if(current != last)
+			{
+				remaining = word(*current);
+				skip_empty();
+			}
+		}
+
+		[[nodiscard]] constexpr
+		std::size_t operator*() const noexcept
+		{
+			assert(remaining != 0);
+			return offset + count_trailing_zeros(remaining);
+		}
+
+		constexpr set_bit_iterator& operator++() noexcept
+		{
+			assert(remaining != 0);
+			remaining &= word(remaining - 1);
+			skip_empty();
+			return *this;
+		}
+
+		constexpr set_bit_iterator operator++(int) noexcept
+		{
+			auto previous = *this;
+			++(*this);
+			return previous;
+		}
+
+		[[nodiscard]] constexpr
+		bool operator==(const set_bit_iterator& other) const noexcept
+		{
+			return current == other.current && remaining == other.remaining;
+		}
+
+		[[nodiscard]] constexpr
+		bool operator!=(const set_bit_iterator& other) const noexcept
+		{
+			return !(*this == other);
+		}
+
+		private:
+		WordIt current{};
+		WordIt last{};
+		word remaining = 0;
+		std::size_t offset = 0;
+
+		constexpr void skip_empty() noexcept
+		{
+			while(remaining == 0 && ++current != last)
+			{
+				remaining = word(*current);
+				offset += std::numeric_limits<word>::digits;
+			}
+		}
+	};
+
+	template <typename WordIt>
+	struct set_bit_range
+	{
+		WordIt first;
+		WordIt last;
+
+		[[nodiscard]] constexpr
+		set_bit_iterator<WordIt> begin() const noexcept
+		{ return {first, last}; }
+
+		[[nodiscard]] constexpr
+		set_bit_iterator<WordIt> end() const noexcept
+		{ return {last, last}; }
+	};
+
+	template <typename WordIt>
+	[[nodiscard]] constexpr
+	set_bit_range<WordIt> set_bits(WordIt begin, WordIt end) noexcept
+	{
+		return {begin, end};
+	}
+
+	template <typename Range, std::enable_if_t<is_range_v<Range>>* = nullptr>
+	[[nodiscard]] constexpr
+	auto set_bits(const Range& range) noexcept
+	{
+		using std::begin;
+		using std::end;
+		return set_bits(begin(range), end(range));
+	}
+
 }} // namespace simple::support
 
 
@@ -24,6 +24,18 @@ namespace simple::support
 	template <typename IntSeq>
 	using cdr = typename carcdr<IntSeq>::cdr;
 
+	namespace detail
+	{
+		template <typename IntSeq>
+		struct lisp_list_values;
+
+		template <typename Int, Int... Values>
+		struct lisp_list_values<std::integer_sequence<Int, Values...>>
+		{
+			constexpr static Int values[] = {Values...};
+		};
+	} // namespace detail
+
 	template <typename List, size_t = 0, auto ... Rest>
 	std::nullptr_t car;
 
@@ -43,10 +55,8 @@ namespace simple::support
 	car<List, N> = []()
 	{
 		static_assert( N < List::size() );
-		if constexpr (N == 0)
-			return car<List>;
-		else
-			return car<cdr<List>, N - 1>;
+		// straight indexing instead of taking the cdr N times
+		return detail::lisp_list_values<List>::values[N];
 	}();
 
 	template <typename List>
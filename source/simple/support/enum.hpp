@@ -3,8 +3,12 @@
 
 #include <type_traits>
 #include <string>
+#include <string_view>
 #include <algorithm>
 #include <array>
+#include <vector>
+#include <numeric>
+#include <cstdint>
 #include "function_utils.hpp"
 #include "type_traits.hpp"
 
@@ -35,6 +39,135 @@ namespace simple::support
 		struct has_from_conversion<Type, decltype((void)Type::from, nullptr)>
 		{ static constexpr bool value = true; };
 
+		// a minimal perfect hash over a set of strings, built once at runtime
+		// (hash and displace, a la CHD), so a lookup is one hash of the string,
+		// two table reads and one string comparison,
+		// a few strings are just compared one by one, that's faster (see benchmarks/enum.cpp),
+		// keeps its own copy of the strings, so they can come from anywhere
+		class perfect_hash
+		{
+			public:
+			static constexpr std::size_t npos = -1;
+
+			// index of the first occurrence of each string, later duplicates are ignored
+			explicit perfect_hash(std::vector<std::string> strings) :
+				keys(std::move(strings))
+			{
+				if(keys.size() < min_size)
+					return;
+
+				std::vector<std::size_t> order(keys.size());
+				std::iota(order.begin(), order.end(), 0);
+				std::stable_sort(order.begin(), order.end(),
+					[this](auto a, auto b) { return keys[a] < keys[b]; });
+				order.erase(std::unique(order.begin(), order.end(),
+					[this](auto a, auto b) { return keys[a] == keys[b]; }), order.end());
+
+				std::size_t size = 1;
+				while(size < order.size())
+					size <<= 1;
+				bucket_mask = size - 1;
+				slot_mask = (size << 1) - 1;
+				displacements.assign(size, 0);
+				slots.assign(size << 1, npos);
+
+				std::vector<std::vector<std::size_t>> buckets(size);
+				for(auto key : order)
+					buckets[hash(keys[key]) & bucket_mask].push_back(key);
+
+				std::vector<std::size_t> bucket_order(size);
+				std::iota(bucket_order.begin(), bucket_order.end(), 0);
+				std::stable_sort(bucket_order.begin(), bucket_order.end(),
+					[&](auto a, auto b) { return buckets[a].size() > buckets[b].size(); });
+
+				// largest buckets first, each gets the first displacement
+				// that puts all of its keys into distinct free slots,
+				// if there is none (keys with the same hash never separate) the bucket is searched linearly instead
+				std::vector<std::size_t> taken;
+				for(auto bucket : bucket_order)
+				{
+					if(buckets[bucket].empty())
+						break;
+					for(std::uint64_t displacement = 0; ; ++displacement)
+					{
+						if(displacement == max_displacement)
+						{
+							displacements[bucket] = linear | linear_buckets.size();
+							linear_buckets.push_back(std::move(buckets[bucket]));
+							break;
+						}
+						taken.clear();
+						for(auto key : buckets[bucket])
+						{
+							const std::size_t slot = place(hash(keys[key]), displacement);
+							if(slots[slot] != npos || std::find(taken.begin(), taken.end(), slot) != taken.end())
+								break;
+							taken.push_back(slot);
+						}
+						if(taken.size() == buckets[bucket].size())
+						{
+							displacements[bucket] = displacement;
+							for(std::size_t i = 0; i < taken.size(); ++i)
+								slots[taken[i]] = buckets[bucket][i];
+							break;
+						}
+					}
+				}
+			}
+
+			std::size_t find(std::string_view key) const noexcept
+			{
+				if(keys.size() < min_size)
+				{
+					const auto found = std::find(keys.begin(), keys.end(), key);
+					return found != keys.end() ? std::size_t(found - keys.begin()) : npos;
+				}
+				const std::uint64_t h = hash(key);
+				const std::uint64_t displacement = displacements[h & bucket_mask];
+				if(displacement & linear)
+				{
+					for(auto index : linear_buckets[displacement & ~linear])
+						if(keys[index] == key)
+							return index;
+					return npos;
+				}
+				const std::size_t index = slots[place(h, displacement)];
+				return index != npos && keys[index] == key ? index : npos;
+			}
+
+			private:
+			static constexpr std::size_t min_size = 8;
+			static constexpr std::uint64_t max_displacement = std::uint64_t(1) << 16;
+			// marks a displacement as an index into linear_buckets
+			static constexpr std::uint64_t linear = std::uint64_t(1) << 63;
+
+			std::vector<std::string> keys;
+			std::vector<std::uint64_t> displacements;
+			std::vector<std::size_t> slots;
+			std::vector<std::vector<std::size_t>> linear_buckets;
+			std::size_t bucket_mask = 0;
+			std::size_t slot_mask = 0;
+
+			// FNV-1a
+			static std::uint64_t hash(std::string_view key) noexcept
+			{
+				std::uint64_t h = 0xcbf29ce484222325;
+				for(unsigned char c : key)
+					h = (h ^ c) * 0x100000001b3;
+				return h;
+			}
+
+			// murmur finalizer, so that each displacement is a different hash
+			std::size_t place(std::uint64_t h, std::uint64_t displacement) const noexcept
+			{
+				h += displacement * 0x9e3779b97f4a7c15;
+				h ^= h >> 33;
+				h *= 0xff51afd7ed558ccd;
+				h ^= h >> 33;
+				return std::size_t(h) & slot_mask;
+			}
+		};
+
 	} // namespace enum_details
 
 	template<typename GutsType>
@@ -108,18 +241,44 @@ namespace simple::support
 		static constexpr auto default_value = DefaultEnumValue;
 		static map_type map;
 
-		static type from(const MappedType& value)
+		// names are looked up by content through a perfect hash,
+		// anything else is searched for linearly
+		using key_type = std::conditional_t<
+			std::is_convertible_v<const MappedType&, std::string_view>,
+			std::string_view, MappedType>;
+
+		static type from(const key_type& value)
 		{
-			for(underlying_type i = 0; i < static_cast<underlying_type>(default_value); ++i)
+			if constexpr (std::is_same_v<key_type, std::string_view>)
+			{
+				static const enum_details::perfect_hash names = []()
+				{
+					// copies, so the hash doesn't rely on what map's elements
+					// convert to staying valid and unchanged
+					std::vector<std::string> names;
+					names.reserve(map.size() * MappedValueCount);
+					for(auto&& variants : map)
+						for(auto&& name : variants)
+							names.emplace_back(std::string_view(name));
+					return enum_details::perfect_hash(std::move(names));
+				}();
+				const std::size_t found = names.find(value);
+				return found == enum_details::perfect_hash::npos
+					? default_value : type(found / MappedValueCount);
+			}
+			else
 			{
-				auto&& variants = map[i];
-				auto end = std::end(variants);
-				auto begin = std::begin(variants);
-				auto found = std::find(begin, end, value);
-				if(found != end)
-					return type(i);
+				for(underlying_type i = 0; i < static_cast<underlying_type>(default_value); ++i)
+				{
+					auto&& variants = map[i];
+					auto end = std::end(variants);
+					auto begin = std::begin(variants);
+					auto found = std::find(begin, end, value);
+					if(found != end)
+						return type(i);
+				}
+				return default_value;
 			}
-			return default_value;
 		}
 
 		static MappedType to(const type& value)
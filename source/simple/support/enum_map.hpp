@@ -0,0 +1,299 @@
+#ifndef SIMPLE_SUPPORT_ENUM_MAP_HPP
+#define SIMPLE_SUPPORT_ENUM_MAP_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <climits>
+#include <iterator>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+
+#include "array.hpp"
+#include "bits.hpp"
+#include "enum.hpp"
+#include "type_traits.hpp"
+
+namespace simple::support
+{
+
+	namespace enum_details
+	{
+
+		template <typename Enum, typename = std::nullptr_t>
+		struct enum_type { using type = Enum; };
+		template <typename Wrapper>
+		struct enum_type<Wrapper, std::enable_if_t<
+			is_template_instance_v<enum_wrapper, Wrapper>, std::nullptr_t>>
+		{ using type = typename Wrapper::type; };
+
+		template <typename Enum>
+		using enum_type_t = typename enum_type<Enum>::type;
+
+		template <typename Enum>
+		constexpr std::size_t index(Enum value) noexcept
+		{ return static_cast<std::size_t>(to_integer(value)); }
+
+	} // namespace enum_details
+
+	// number of values of an enum, for the dense containers below,
+	// mapped enums with a default value know it already, since the default is one past the last,
+	// for anything else specialize this or pass the size explicitly
+	template <typename Enum, typename = std::nullptr_t>
+	struct enum_size {};
+
+	template <typename Wrapper>
+	struct enum_size<Wrapper, std::enable_if_t<
+		is_template_instance_v<enum_wrapper, Wrapper> &&
+		enum_details::has_default<typename Wrapper::guts>::value, std::nullptr_t>>
+	: std::integral_constant<std::size_t, enum_details::index(Wrapper::guts::default_value)> {};
+
+	template <typename Enum>
+	constexpr std::size_t enum_size_v = enum_size<Enum>::value;
+
+	// a value for every enum value, in a flat array indexed by the enum
+	template <typename Enum, typename Value, std::size_t Size = enum_size_v<Enum>>
+	struct enum_map
+	{
+		using key_type = enum_details::enum_type_t<Enum>;
+		using mapped_type = Value;
+		using storage_type = array<Value, Size>;
+		using iterator = typename storage_type::iterator;
+		using const_iterator = typename storage_type::const_iterator;
+		static_assert(std::is_enum_v<key_type>);
+
+		storage_type values;
+
+		[[nodiscard]] constexpr Value& operator[](key_type key) noexcept
+		{
+			assert(enum_details::index(key) < Size);
+			return values[enum_details::index(key)];
+		}
+
+		[[nodiscard]] constexpr const Value& operator[](key_type key) const noexcept
+		{
+			assert(enum_details::index(key) < Size);
+			return values[enum_details::index(key)];
+		}
+
+		[[nodiscard]] constexpr Value& at(key_type key)
+		{ return values.at(enum_details::index(key)); }
+
+		[[nodiscard]] constexpr const Value& at(key_type key) const
+		{ return values.at(enum_details::index(key)); }
+
+		[[nodiscard]] static constexpr key_type key(std::size_t index) noexcept
+		{
+			assert(index < Size);
+			return static_cast<key_type>(index);
+		}
+
+		[[nodiscard]] static constexpr std::size_t size() noexcept
+		{ return Size; }
+
+		constexpr void fill(const Value& value)
+		{ values.fill(value); }
+
+		constexpr iterator begin() noexcept { return values.begin(); }
+		constexpr iterator end() noexcept { return values.end(); }
+		constexpr const_iterator begin() const noexcept { return values.begin(); }
+		constexpr const_iterator end() const noexcept { return values.end(); }
+
+		[[nodiscard]] friend constexpr bool operator==(const enum_map& one, const enum_map& other)
+		{ return one.values == other.values; }
+		[[nodiscard]] friend constexpr bool operator!=(const enum_map& one, const enum_map& other)
+		{ return !(one == other); }
+	};
+
+	// a bit for every enum value, iterated in order by skipping to the next set bit
+	template <typename Enum, std::size_t Size = enum_size_v<Enum>>
+	class enum_set
+	{
+		public:
+		using key_type = enum_details::enum_type_t<Enum>;
+		using word = std::uint64_t;
+		static_assert(std::is_enum_v<key_type>);
+
+		private:
+		static constexpr std::size_t word_bits = sizeof(word) * CHAR_BIT;
+		static constexpr std::size_t word_count = (Size + word_bits - 1) / word_bits;
+
+		array<word, word_count> words{};
+
+		static constexpr word bit(std::size_t index) noexcept
+		{ return word{1} << (index % word_bits); }
+
+		public:
+		class iterator
+		{
+			const word* words = nullptr;
+			std::size_t index = 0; // of the current word
+			word remaining = 0; // bits of the current word not visited yet
+
+			constexpr void skip_empty() noexcept
+			{
+				while(remaining == 0 && index + 1 < word_count)
+					remaining = words[++index];
+			}
+
+			public:
+			using value_type = key_type;
+			using difference_type = std::ptrdiff_t;
+			using pointer = void;
+			using reference = key_type;
+			using iterator_category = std::forward_iterator_tag;
+
+			constexpr iterator() noexcept = default;
+			constexpr iterator(const word* words, std::size_t index, word remaining) noexcept :
+				words(words), index(index), remaining(remaining)
+			{ skip_empty(); }
+
+			[[nodiscard]] constexpr key_type operator*() const noexcept
+			{ return static_cast<key_type>(index * word_bits + count_trailing_zeros(remaining)); }
+
+			constexpr iterator& operator++() noexcept
+			{
+				remaining &= remaining - 1; // clear the lowest set bit
+				skip_empty();
+				return *this;
+			}
+
+			constexpr iterator operator++(int) noexcept
+			{
+				iterator previous = *this;
+				++(*this);
+				return previous;
+			}
+
+			[[nodiscard]] friend constexpr bool operator==(const iterator& one, const iterator& other) noexcept
+			{ return one.index == other.index && one.remaining == other.remaining; }
+			[[nodiscard]] friend constexpr bool operator!=(const iterator& one, const iterator& other) noexcept
+			{ return !(one == other); }
+		};
+		using const_iterator = iterator;
+
+		constexpr enum_set() noexcept = default;
+
+		constexpr enum_set(std::initializer_list<key_type> keys) noexcept
+		{
+			for(auto key : keys)
+				insert(key);
+		}
+
+		[[nodiscard]] static constexpr enum_set all() noexcept
+		{
+			enum_set result;
+			for(auto& w : result.words)
+				w = ~word{};
+			if constexpr (Size % word_bits != 0)
+				result.words[word_count - 1] = bit(Size) - 1;
+			return result;
+		}
+
+		constexpr void insert(key_type key) noexcept
+		{
+			assert(enum_details::index(key) < Size);
+			words[enum_details::index(key) / word_bits] |= bit(enum_details::index(key));
+		}
+
+		constexpr void erase(key_type key) noexcept
+		{
+			assert(enum_details::index(key) < Size);
+			words[enum_details::index(key) / word_bits] &= ~bit(enum_details::index(key));
+		}
+
+		[[nodiscard]] constexpr bool contains(key_type key) const noexcept
+		{
+			assert(enum_details::index(key) < Size);
+			return words[enum_details::index(key) / word_bits] & bit(enum_details::index(key));
+		}
+
+		[[nodiscard]] constexpr std::size_t size() const noexcept
+		{
+			std::size_t count = 0;
+			for(auto w : words)
+				count += count_ones(w);
+			return count;
+		}
+
+		[[nodiscard]] constexpr bool empty() const noexcept
+		{
+			for(auto w : words)
+				if(w != 0)
+					return false;
+			return true;
+		}
+
+		[[nodiscard]] static constexpr std::size_t max_size() noexcept
+		{ return Size; }
+
+		constexpr void clear() noexcept
+		{ words = {}; }
+
+		[[nodiscard]] constexpr iterator begin() const noexcept
+		{
+			if constexpr (word_count == 0)
+				return end();
+			else
+				return iterator(words.data(), 0, words[0]);
+		}
+
+		[[nodiscard]] constexpr iterator end() const noexcept
+		{ return iterator(words.data(), word_count == 0 ? 0 : word_count - 1, 0); }
+
+		friend constexpr enum_set& operator|=(enum_set& one, const enum_set& other) noexcept
+		{
+			for(std::size_t i = 0; i < word_count; ++i)
+				one.words[i] |= other.words[i];
+			return one;
+		}
+
+		friend constexpr enum_set& operator&=(enum_set& one, const enum_set& other) noexcept
+		{
+			for(std::size_t i = 0; i < word_count; ++i)
+				one.words[i] &= other.words[i];
+			return one;
+		}
+
+		friend constexpr enum_set& operator^=(enum_set& one, const enum_set& other) noexcept
+		{
+			for(std::size_t i = 0; i < word_count; ++i)
+				one.words[i] ^= other.words[i];
+			return one;
+		}
+
+		// difference
+		friend constexpr enum_set& operator-=(enum_set& one, const enum_set& other) noexcept
+		{
+			for(std::size_t i = 0; i < word_count; ++i)
+				one.words[i] &= ~other.words[i];
+			return one;
+		}
+
+		[[nodiscard]] friend constexpr enum_set operator|(enum_set one, const enum_set& other) noexcept
+		{ return one |= other; }
+		[[nodiscard]] friend constexpr enum_set operator&(enum_set one, const enum_set& other) noexcept
+		{ return one &= other; }
+		[[nodiscard]] friend constexpr enum_set operator^(enum_set one, const enum_set& other) noexcept
+		{ return one ^= other; }
+		[[nodiscard]] friend constexpr enum_set operator-(enum_set one, const enum_set& other) noexcept
+		{ return one -= other; }
+
+		[[nodiscard]] friend constexpr enum_set operator~(const enum_set& one) noexcept
+		{ return all() - one; }
+
+		[[nodiscard]] friend constexpr bool operator==(const enum_set& one, const enum_set& other) noexcept
+		{
+			for(std::size_t i = 0; i < word_count; ++i)
+				if(one.words[i] != other.words[i])
+					return false;
+			return true;
+		}
+		[[nodiscard]] friend constexpr bool operator!=(const enum_set& one, const enum_set& other) noexcept
+		{ return !(one == other); }
+	};
+
+} // namespace simple::support
+
+#endif /* end of include guard */
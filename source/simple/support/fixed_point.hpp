@@ -0,0 +1,246 @@
+#ifndef SIMPLE_SUPPORT_FIXED_POINT_HPP
+#define SIMPLE_SUPPORT_FIXED_POINT_HPP
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "overflow.hpp"
+#include "rational.hpp"
+#include "wide_int.hpp"
+#include "int_literals.hpp"
+
+namespace simple::support
+{
+
+	namespace detail
+	{
+		// wide enough for a product of two magnitudes
+		template <typename Unsigned>
+		using fixed_point_wide_t = std::conditional_t<sizeof(Unsigned) <= sizeof(std::uint32_t),
+			std::uint64_t, wide_uint<128>>;
+	} // namespace detail
+
+	// Int with the lowest FracBits bits representing the fraction,
+	// a rational with a power of two denominator, that saturates instead of overflowing,
+	// results of multiplication and division are rounded to nearest (ties away from zero)
+	template <typename Int, int FracBits>
+	class fixed_point
+	{
+		static_assert(std::is_integral_v<Int> && not std::is_same_v<Int, bool>);
+		using unsigned_t = std::make_unsigned_t<Int>;
+		using wide_t = detail::fixed_point_wide_t<unsigned_t>;
+		using limits = std::numeric_limits<Int>;
+		static_assert(FracBits >= 0 && FracBits < std::numeric_limits<unsigned_t>::digits,
+			"The denominator must fit the unsigned type.");
+
+		Int raw_value{};
+
+		static constexpr unsigned_t magnitude(Int x) noexcept
+		{ return x < Int{} ? unsigned_t(unsigned_t(0) - unsigned_t(x)) : unsigned_t(x); }
+
+		// the largest magnitude that fits with the given sign
+		static constexpr unsigned_t limit(bool negative) noexcept
+		{ return negative ? magnitude(limits::min()) : unsigned_t(limits::max()); }
+
+		template <typename Wide>
+		static constexpr fixed_point saturate(const Wide& magnitude, bool negative) noexcept
+		{
+			if(magnitude > Wide(limit(negative)))
+				return from_raw(detail::saturation<Int>(negative));
+			const auto result = unsigned_t(magnitude);
+			return from_raw(Int(negative ? unsigned_t(unsigned_t(0) - result) : result));
+		}
+
+		public:
+		using rep = Int;
+		static constexpr int fraction_bits = FracBits;
+		using denominator = meta_constant<unsigned_t, unsigned_t(unsigned_t(1) << FracBits)>;
+		using ratio_type = rational<Int, denominator>;
+
+		constexpr fixed_point() noexcept = default;
+
+		template <typename Integer, std::enable_if_t<
+			std::is_integral_v<Integer> && not std::is_same_v<Integer, bool>>* = nullptr>
+		constexpr explicit fixed_point(Integer value) noexcept
+		{
+			const bool negative = value < Integer{};
+			if(negative && std::is_unsigned_v<Int>)
+				return;
+			const std::uintmax_t value_magnitude = negative
+				? std::uintmax_t(0) - std::uintmax_t(value) : std::uintmax_t(value);
+			*this = value_magnitude > (std::uintmax_t(limit(negative)) >> FracBits)
+				? from_raw(detail::saturation<Int>(negative))
+				: saturate(unsigned_t(unsigned_t(value_magnitude) << FracBits), negative);
+		}
+
+		// rounds to nearest, NaN is zero
+		template <typename Float, std::enable_if_t<std::is_floating_point_v<Float>>* = nullptr>
+		constexpr explicit fixed_point(Float value) noexcept
+		{
+			if(value != value)
+				return;
+			const Float scaled = value * Float(denominator::value);
+			// powers of two, so exact
+			const Float upper = Float(unsigned_t(unsigned_t(1) << (limits::digits - 1))) * 2;
+			const Float lower = Float(limits::min());
+			if(scaled >= upper)
+				raw_value = limits::max();
+			else if(scaled < lower)
+				raw_value = limits::min();
+			else
+			{
+				raw_value = Int(scaled);
+				const Float fraction = scaled - Float(raw_value);
+				if(fraction >= Float(0.5))
+					raw_value = detail::saturating_add<Int>(raw_value, Int{1});
+				else if(fraction <= Float(-0.5))
+					raw_value = detail::saturating_sub<Int>(raw_value, Int{1});
+			}
+		}
+
+		// from any other compile time denominator
+		template <typename Denom, std::enable_if_t<
+			detail::rational_traits::has_fast_denominator_v<Int, Denom>>* = nullptr>
+		constexpr explicit fixed_point(const rational<Int, Denom>& value) noexcept :
+			raw_value(rational_cast<denominator, rounding::nearest>(value).numerator())
+		{}
+
+		[[nodiscard]] static constexpr fixed_point from_raw(Int raw) noexcept
+		{
+			fixed_point result;
+			result.raw_value = raw;
+			return result;
+		}
+
+		[[nodiscard]] constexpr Int raw() const noexcept
+		{ return raw_value; }
+
+		[[nodiscard]] constexpr ratio_type ratio() const noexcept
+		{ return ratio_type(raw_value, denominator{}); }
+
+		template <rounding Mode = rounding::floor>
+		[[nodiscard]] constexpr Int to_integer() const noexcept
+		{ return ratio().template round<Mode>(); }
+
+		template <typename Float, std::enable_if_t<std::is_floating_point_v<Float>>* = nullptr>
+		[[nodiscard]] constexpr explicit operator Float() const noexcept
+		{ return Float(raw_value) / Float(denominator::value); }
+
+		[[nodiscard]] friend constexpr fixed_point operator+(const fixed_point& one, const fixed_point& other) noexcept
+		{ return from_raw(detail::saturating_add<Int>(one.raw_value, other.raw_value)); }
+
+		[[nodiscard]] friend constexpr fixed_point operator-(const fixed_point& one, const fixed_point& other) noexcept
+		{ return from_raw(detail::saturating_sub<Int>(one.raw_value, other.raw_value)); }
+
+		[[nodiscard]] friend constexpr fixed_point operator-(const fixed_point& one) noexcept
+		{ return from_raw(detail::saturating_sub<Int>(Int{}, one.raw_value)); }
+
+		[[nodiscard]] friend constexpr fixed_point operator*(const fixed_point& one, const fixed_point& other) noexcept
+		{
+			const bool negative = (one.raw_value < Int{}) != (other.raw_value < Int{});
+			wide_t product = wide_t(magnitude(one.raw_value)) * wide_t(magnitude(other.raw_value));
+			if constexpr (FracBits != 0)
+				product = (product + wide_t(unsigned_t(unsigned_t(1) << (FracBits - 1)))) >> FracBits;
+			return saturate(product, negative);
+		}
+
+		// division by zero saturates, unless it's 0/0 which is 0
+		[[nodiscard]] friend constexpr fixed_point operator/(const fixed_point& one, const fixed_point& other) noexcept
+		{
+			const bool negative = (one.raw_value < Int{}) != (other.raw_value < Int{});
+			if(other.raw_value == Int{})
+				return from_raw(one.raw_value == Int{} ? Int{} : detail::saturation<Int>(one.raw_value < Int{}));
+			const wide_t divisor = wide_t(magnitude(other.raw_value));
+			const wide_t dividend = wide_t(magnitude(one.raw_value)) << FracBits;
+			wide_t quotient = dividend / divisor;
+			const wide_t remainder = dividend - quotient * divisor;
+			if(remainder >= divisor - remainder)
+				quotient += wide_t(1);
+			return saturate(quotient, negative);
+		}
+
+		[[nodiscard]] friend constexpr bool operator==(const fixed_point& one, const fixed_point& other) noexcept
+		{ return one.raw_value == other.raw_value; }
+		[[nodiscard]] friend constexpr bool operator!=(const fixed_point& one, const fixed_point& other) noexcept
+		{ return one.raw_value != other.raw_value; }
+		[[nodiscard]] friend constexpr bool operator<(const fixed_point& one, const fixed_point& other) noexcept
+		{ return one.raw_value < other.raw_value; }
+		[[nodiscard]] friend constexpr bool operator<=(const fixed_point& one, const fixed_point& other) noexcept
+		{ return one.raw_value <= other.raw_value; }
+		[[nodiscard]] friend constexpr bool operator>(const fixed_point& one, const fixed_point& other) noexcept
+		{ return one.raw_value > other.raw_value; }
+		[[nodiscard]] friend constexpr bool operator>=(const fixed_point& one, const fixed_point& other) noexcept
+		{ return one.raw_value >= other.raw_value; }
+
+		friend constexpr fixed_point& operator+=(fixed_point& one, const fixed_point& other) noexcept
+		{ return one = one + other; }
+		friend constexpr fixed_point& operator-=(fixed_point& one, const fixed_point& other) noexcept
+		{ return one = one - other; }
+		friend constexpr fixed_point& operator*=(fixed_point& one, const fixed_point& other) noexcept
+		{ return one = one * other; }
+		friend constexpr fixed_point& operator/=(fixed_point& one, const fixed_point& other) noexcept
+		{ return one = one / other; }
+	};
+
+} // namespace simple::support
+
+namespace simple::support::literals
+{
+
+	namespace details
+	{
+
+		constexpr wide_uint<128> power_of_ten(int exponent) noexcept
+		{
+			wide_uint<128> result = 1;
+			while(exponent --> 0)
+				result *= wide_uint<128>(10);
+			return result;
+		}
+
+		template <typename Fixed, char... chars>
+		constexpr Fixed parse_fixed_point() noexcept
+		{
+			using rep = typename Fixed::rep;
+			constexpr char literal[] = {chars...};
+			constexpr decimal value = parse_decimal(literal, sizeof...(chars));
+			static_assert( value.valid, "Invalid fixed point literal, only decimal digits with a point are supported" );
+			static_assert( not value.overflow, "Fixed point literal has too many digits" );
+			// so that the power of ten fits, and the mantissa shifted by less than 64 does too
+			static_assert( value.scale <= 38, "Fixed point literal has too many digits after the point" );
+
+			// rounded to nearest, ties away from zero, same as fixed_point(double)
+			constexpr wide_uint<128> divisor = power_of_ten(value.scale);
+			constexpr wide_uint<128> raw =
+				((wide_uint<128>(value.mantissa) << Fixed::fraction_bits) + (divisor >> 1)) / divisor;
+			static_assert( raw <= wide_uint<128>(std::numeric_limits<rep>::max()), "Fixed point literal out of range" );
+			return Fixed::from_raw(static_cast<rep>(raw));
+		}
+
+		using q8 = fixed_point<int16_t, 8>;
+		using q15 = fixed_point<int16_t, 15>;
+		using q16 = fixed_point<int32_t, 16>;
+		using q31 = fixed_point<int32_t, 31>;
+		using q32 = fixed_point<int64_t, 32>;
+
+	} // namespace details
+
+#define SIMPLE_SUPPORT_DEFINE_FIXED_POINT_LITERAL_OPERATOR(type, name) \
+	template<char... chars> \
+	constexpr type operator"" name() \
+	{ \
+		return details::parse_fixed_point<type, chars...>(); \
+	} \
+
+SIMPLE_SUPPORT_DEFINE_FIXED_POINT_LITERAL_OPERATOR(details::q8, _q8);
+SIMPLE_SUPPORT_DEFINE_FIXED_POINT_LITERAL_OPERATOR(details::q15, _q15);
+SIMPLE_SUPPORT_DEFINE_FIXED_POINT_LITERAL_OPERATOR(details::q16, _q16);
+SIMPLE_SUPPORT_DEFINE_FIXED_POINT_LITERAL_OPERATOR(details::q31, _q31);
+SIMPLE_SUPPORT_DEFINE_FIXED_POINT_LITERAL_OPERATOR(details::q32, _q32);
+
+#undef SIMPLE_SUPPORT_DEFINE_FIXED_POINT_LITERAL_OPERATOR
+
+} // namespace simple::support::literals
+
+#endif /* end of include guard */
@@ -0,0 +1,94 @@
+#ifndef SIMPLE_SUPPORT_FORMAT_HPP
+#define SIMPLE_SUPPORT_FORMAT_HPP
+
+#include <charconv>
+#include <cstddef>
+#include <system_error>
+#include <type_traits>
+
+#include "array.hpp"
+#include "misc.hpp"
+#include "range.hpp"
+#include "rational.hpp"
+
+// stream free formatting into caller provided buffers,
+// with the result and error contract of std::to_chars,
+// on error ptr is last and ec is value_too_large,
+// no locale, no allocation and no formatting state to save and restore
+
+namespace simple::support
+{
+
+	namespace detail::format
+	{
+		inline std::to_chars_result put(char* first, char* last, char c) noexcept
+		{
+			if(first == last)
+				return {last, std::errc::value_too_large};
+			*first = c;
+			return {first + 1, std::errc{}};
+		}
+	} // namespace detail::format
+
+	// integers in decimal, floating point in the shortest form that reads back to the same value
+	// (std::to_chars does this with Ryu in libstdc++ and MSVC, no need for our own)
+	template <typename N, std::enable_if_t<
+		std::is_arithmetic_v<N> && not std::is_same_v<N, bool>>* = nullptr>
+	std::to_chars_result format_to(char* first, char* last, N value) noexcept
+	{
+		return std::to_chars(first, last, value);
+	}
+
+	// numerator/denominator, for known denominators too
+	template <typename Num, typename Denom>
+	std::to_chars_result format_to(char* first, char* last, const rational<Num, Denom>& value) noexcept
+	{
+		auto result = format_to(first, last, value.numerator());
+		if(std::errc{} != result.ec)
+			return result;
+		result = detail::format::put(result.ptr, last, '/');
+		if(std::errc{} != result.ec)
+			return result;
+		return format_to(result.ptr, last, static_cast<Num>(value.denominator()));
+	}
+
+	// elements one after another with a separator between them
+	template <typename T, std::size_t Size>
+	std::to_chars_result format_to(char* first, char* last, const array<T, Size>& values, char separator = ' ') noexcept
+	{
+		std::to_chars_result result{first, std::errc{}};
+		for(std::size_t i = 0; i < Size; ++i)
+		{
+			if(i != 0)
+			{
+				result = detail::format::put(result.ptr, last, separator);
+				if(std::errc{} != result.ec)
+					return result;
+			}
+			result = format_to(result.ptr, last, values[i]);
+			if(std::errc{} != result.ec)
+				return result;
+		}
+		return result;
+	}
+
+	// lower, separator and upper, same as to_chars and to_string from misc.hpp,
+	// so a ':' separator means the upper bound is written as an offset from the lower,
+	// and storn can read it back either way
+	template <typename T>
+	std::to_chars_result format_to(char* first, char* last, const range<T>& value, char separator = '-') noexcept
+	{
+		if constexpr (std::is_arithmetic_v<T>)
+			return to_chars(first, last, value, separator);
+		else
+		{
+			auto bounds = value.bounds;
+			if(':' == separator)
+				bounds[1] -= bounds[0];
+			return format_to(first, last, bounds, separator);
+		}
+	}
+
+} // namespace simple::support
+
+#endif /* end of include guard */
@@ -0,0 +1,130 @@
+#ifndef SIMPLE_SUPPORT_HETEROGENEOUS_VECTOR_HPP
+#define SIMPLE_SUPPORT_HETEROGENEOUS_VECTOR_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "function_utils.hpp"
+#include "tuple_utils/meta_find.hpp"
+
+namespace simple::support
+{
+
+	// a vector per type, instead of one vector of variants,
+	// so objects of the same type are contiguous and are processed in bulk,
+	// without a branch on the alternative per object,
+	// the order between objects of different types is not kept
+	template <typename... Types>
+	class heterogeneous_vector
+	{
+		public:
+		using types = std::tuple<Types...>;
+
+		template <typename T>
+		static constexpr std::size_t index_of = find_v<T, types>;
+
+		template <typename T>
+		static constexpr bool contains_type = index_of<T> < sizeof...(Types);
+
+		template <typename T>
+		using vector_type = std::vector<T>;
+
+		private:
+		template <std::size_t... I>
+		static constexpr bool unique(std::index_sequence<I...>)
+		{ return ((index_of<Types> == I) && ...); }
+		static_assert(unique(std::make_index_sequence<sizeof...(Types)>{}),
+			"heterogeneous_vector types must be unique");
+
+		std::tuple<std::vector<Types>...> vectors;
+
+		template <typename T>
+		static constexpr void check_type()
+		{ static_assert(contains_type<T>, "heterogeneous_vector doesn't store this type"); }
+
+		public:
+
+		template <typename T>
+		[[nodiscard]] std::vector<T>& get() noexcept
+		{
+			check_type<T>();
+			return std::get<index_of<T>>(vectors);
+		}
+
+		template <typename T>
+		[[nodiscard]] const std::vector<T>& get() const noexcept
+		{
+			check_type<T>();
+			return std::get<index_of<T>>(vectors);
+		}
+
+		template <typename T>
+		void push_back(T&& value)
+		{ get<std::decay_t<T>>().push_back(std::forward<T>(value)); }
+
+		template <typename T, typename... Args>
+		T& emplace_back(Args&&... args)
+		{ return get<T>().emplace_back(std::forward<Args>(args)...); }
+
+		// moves the last object of the type in place of the erased one,
+		// invalidates the index of that last one
+		template <typename T>
+		void swap_erase(std::size_t index)
+		{
+			auto& vector = get<T>();
+			assert(index < vector.size());
+			if(index != vector.size() - 1)
+				vector[index] = std::move(vector.back());
+			vector.pop_back();
+		}
+
+		template <typename T>
+		[[nodiscard]] std::size_t size() const noexcept
+		{ return get<T>().size(); }
+
+		[[nodiscard]] std::size_t size() const noexcept
+		{ return (std::size_t{} + ... + get<Types>().size()); }
+
+		[[nodiscard]] bool empty() const noexcept
+		{ return (get<Types>().empty() && ...); }
+
+		template <typename T>
+		void reserve(std::size_t capacity)
+		{ get<T>().reserve(capacity); }
+
+		void clear() noexcept
+		{ (get<Types>().clear(), ...); }
+
+		// every object of one type
+		template <typename T, typename F>
+		void for_each(F&& f)
+		{
+			for(auto& object : get<T>())
+				support::invoke(f, object);
+		}
+
+		template <typename T, typename F>
+		void for_each(F&& f) const
+		{
+			for(const auto& object : get<T>())
+				support::invoke(f, object);
+		}
+
+		// every object, one type after another in the order of the type list,
+		// the function must accept every type
+		template <typename F>
+		void for_each(F&& f)
+		{ (for_each<Types>(f), ...); }
+
+		template <typename F>
+		void for_each(F&& f) const
+		{ (for_each<Types>(f), ...); }
+	};
+
+} // namespace simple::support
+
+#endif /* end of include guard */
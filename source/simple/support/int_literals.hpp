@@ -1,6 +1,7 @@
 #ifndef SIMPLE_SUPPORT_INT_LITERALS_HPP
 #define SIMPLE_SUPPORT_INT_LITERALS_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <type_traits>
 #include <limits>
@@ -13,71 +14,172 @@ namespace details
 
 	constexpr char spacer = '\'';
 
-	template <typename Int, uintmax_t base, char first, char... rest>
-	constexpr Int parse() noexcept
+	constexpr unsigned digit_value(char c) noexcept
 	{
-		constexpr uintmax_t digit = first +
-		(
-			( '0' <= first && first <= '9') ? (-'0') :
-			( 'A' <= first && first <= 'Z' ) ? (-'A' + 10) :
-			( 'a' <= first && first <= 'z' ) ? (-'a' + 10) :
-			-first
-		);
-		constexpr auto size = sizeof...(rest);
-		if constexpr(size > 0)
+		return
+			( '0' <= c && c <= '9' ) ? unsigned(c - '0') :
+			( 'A' <= c && c <= 'Z' ) ? unsigned(c - 'A' + 10) :
+			( 'a' <= c && c <= 'z' ) ? unsigned(c - 'a' + 10) :
+			36;
+	}
+
+	template <typename Int>
+	struct parsed
+	{
+		Int value{};
+		bool valid = true;
+		bool overflow = false;
+	};
+
+	// a plain loop over the characters instead of recursing on them,
+	// so the instantiation depth doesn't grow with the length of the literal,
+	// and each digit is only visited once
+	template <typename Int>
+	constexpr parsed<Int> parse(const char* chars, std::size_t size, std::size_t start, unsigned base) noexcept
+	{
+		parsed<Int> result{};
+		constexpr Int max = std::numeric_limits<Int>::max();
+		const Int max_before_digit = max / Int(base);
+		for(std::size_t i = start; i != size; ++i)
 		{
-			constexpr uintmax_t order = ( ... * (rest == spacer ? 1 : base)  );
-			constexpr uintmax_t result = digit * order +
-				static_cast<uintmax_t>(parse<Int, base, rest...>());
-			static_assert( result <= std::numeric_limits<Int>::max(), "Integer literal out of range" );
-			return static_cast<Int>(result);
+			if(chars[i] == spacer)
+				continue;
+			const unsigned digit = digit_value(chars[i]);
+			if(digit >= base)
+			{
+				result.valid = false;
+				return result;
+			}
+			if(result.value > max_before_digit)
+			{
+				result.overflow = true;
+				return result;
+			}
+			result.value *= Int(base);
+			if(result.value > max - Int(digit))
+			{
+				result.overflow = true;
+				return result;
+			}
+			result.value += Int(digit);
 		}
-		return static_cast<Int>(digit);
+		return result;
 	}
 
+	// with the usual prefixes: 0x for hex, 0b for binary and 0 for octal
 	template <typename Int>
-	constexpr Int parse_second() noexcept
+	constexpr parsed<Int> parse_integer(const char* chars, std::size_t size) noexcept
 	{
-		return 0;
+		if(size > 1 && chars[0] == '0')
+		{
+			if(chars[1] == 'x' || chars[1] == 'X')
+				return parse<Int>(chars, size, 2, 16);
+			if(chars[1] == 'b' || chars[1] == 'B')
+				return parse<Int>(chars, size, 2, 2);
+			return parse<Int>(chars, size, 1, 8);
+		}
+		return parse<Int>(chars, size, 0, 10);
 	}
 
-	template <typename Int, char first, char... rest>
-	constexpr Int parse_second() noexcept
+	template <typename Int, char... chars>
+	constexpr Int parse_literal() noexcept
 	{
-		if constexpr (first == 'x')
-			return parse<Int, 16, rest...>();
-		else if constexpr (first == 'b')
-			return parse<Int, 2, rest...>();
-		else
-			return parse<Int, 8, first, rest...>();
+		constexpr char literal[] = {chars...};
+		constexpr auto result = parse_integer<Int>(literal, sizeof...(chars));
+		static_assert( result.valid, "Invalid digit in integer literal" );
+		static_assert( not result.overflow, "Integer literal out of range" );
+		return result.value;
 	}
 
-	template <typename Int, char first, char... rest>
-	constexpr Int parse_first() noexcept
+	// decimal digits with an optional point, as integer mantissa and the number of digits after the point,
+	// without a point it's an integer literal, prefixes and all
+	struct decimal
+	{
+		std::uintmax_t mantissa = 0;
+		int scale = 0;
+		bool valid = true;
+		bool overflow = false;
+	};
+
+	constexpr decimal parse_decimal(const char* chars, std::size_t size) noexcept
 	{
-		if constexpr (first != '0')
-			return parse<Int, 10, first, rest...>();
-		else
-			return parse_second<Int, rest...>();
+		bool point = false;
+		for(std::size_t i = 0; i != size; ++i)
+			point |= chars[i] == '.';
+		if(not point)
+		{
+			const auto integer = parse_integer<std::uintmax_t>(chars, size);
+			return {integer.value, 0, integer.valid, integer.overflow};
+		}
+
+		decimal result{};
+		point = false;
+		for(std::size_t i = 0; i != size; ++i)
+		{
+			if(chars[i] == spacer)
+				continue;
+			if(chars[i] == '.')
+			{
+				point = true;
+				continue;
+			}
+			// no exponents or hex floats
+			const unsigned digit = digit_value(chars[i]);
+			if(digit >= 10)
+			{
+				result.valid = false;
+				return result;
+			}
+			if(result.mantissa > (std::numeric_limits<std::uintmax_t>::max() - digit) / 10)
+			{
+				result.overflow = true;
+				return result;
+			}
+			result.mantissa = result.mantissa * 10 + digit;
+			result.scale += point;
+		}
+		return result;
+	}
+
+	template <int Shift, char... chars>
+	constexpr std::size_t parse_byte_size() noexcept
+	{
+		constexpr std::size_t value = parse_literal<std::size_t, chars...>();
+		static_assert( value <= (std::numeric_limits<std::size_t>::max() >> Shift), "Byte size literal out of range" );
+		return value << Shift;
 	}
 
 } // namespace details
 
-#define SIMPLE_SUPPORT_DEFINE_UNSIGNED_INT_LITERAL_OPERATOR(type, name) \
+#define SIMPLE_SUPPORT_DEFINE_INT_LITERAL_OPERATOR(type, name) \
 	template<char... chars> \
 	constexpr type operator"" name() \
 	{ \
-		return details::parse_first<type, chars...>(); \
+		return details::parse_literal<type, chars...>(); \
+	} \
+
+SIMPLE_SUPPORT_DEFINE_INT_LITERAL_OPERATOR(uint8_t, _u8);
+SIMPLE_SUPPORT_DEFINE_INT_LITERAL_OPERATOR(uint16_t, _u16);
+SIMPLE_SUPPORT_DEFINE_INT_LITERAL_OPERATOR(uint32_t, _u32);
+SIMPLE_SUPPORT_DEFINE_INT_LITERAL_OPERATOR(uint64_t, _u64);
+SIMPLE_SUPPORT_DEFINE_INT_LITERAL_OPERATOR(unsigned char, _uc);
+SIMPLE_SUPPORT_DEFINE_INT_LITERAL_OPERATOR(unsigned short, _us);
+
+#undef SIMPLE_SUPPORT_DEFINE_INT_LITERAL_OPERATOR
+
+#define SIMPLE_SUPPORT_DEFINE_BYTE_SIZE_LITERAL_OPERATOR(shift, name) \
+	template<char... chars> \
+	constexpr std::size_t operator"" name() \
+	{ \
+		return details::parse_byte_size<shift, chars...>(); \
 	} \
 
-SIMPLE_SUPPORT_DEFINE_UNSIGNED_INT_LITERAL_OPERATOR(uint8_t, _u8);
-SIMPLE_SUPPORT_DEFINE_UNSIGNED_INT_LITERAL_OPERATOR(uint16_t, _u16);
-SIMPLE_SUPPORT_DEFINE_UNSIGNED_INT_LITERAL_OPERATOR(uint32_t, _u32);
-SIMPLE_SUPPORT_DEFINE_UNSIGNED_INT_LITERAL_OPERATOR(uint64_t, _u64);
-SIMPLE_SUPPORT_DEFINE_UNSIGNED_INT_LITERAL_OPERATOR(unsigned char, _uc);
-SIMPLE_SUPPORT_DEFINE_UNSIGNED_INT_LITERAL_OPERATOR(unsigned short, _us);
+SIMPLE_SUPPORT_DEFINE_BYTE_SIZE_LITERAL_OPERATOR(10, _KiB);
+SIMPLE_SUPPORT_DEFINE_BYTE_SIZE_LITERAL_OPERATOR(20, _MiB);
+SIMPLE_SUPPORT_DEFINE_BYTE_SIZE_LITERAL_OPERATOR(30, _GiB);
+SIMPLE_SUPPORT_DEFINE_BYTE_SIZE_LITERAL_OPERATOR(40, _TiB);
 
-#undef SIMPLE_SUPPORT_DEFINE_UNSIGNED_INT_LITERAL_OPERATOR
+#undef SIMPLE_SUPPORT_DEFINE_BYTE_SIZE_LITERAL_OPERATOR
 
 } // namespace literals
 
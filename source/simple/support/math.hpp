@@ -1,2 +1,4 @@
 #include "math/float.hpp"
+#include "math/gcd.hpp"
+#include "math/muldiv.hpp"
 #include "math/root.hpp"
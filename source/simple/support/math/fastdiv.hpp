@@ -0,0 +1,119 @@
+#ifndef SIMPLE_SUPPORT_MATH_FASTDIV_HPP
+#define SIMPLE_SUPPORT_MATH_FASTDIV_HPP
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace simple::support
+{
+
+	namespace detail
+	{
+
+		// Lemire, Kaser, Kurz - Faster Remainder by Direct Computation
+		// magic is ceil(2^N / divisor), the quotient is the top half of magic * x,
+		// and the remainder is the top half of the fractional part
+		// (magic * x mod 2^N) scaled back up by the divisor
+		template <typename Unsigned, typename Wide>
+		class fastmod
+		{
+			static_assert(sizeof(Wide) == 2 * sizeof(Unsigned));
+			static constexpr int half_bits = sizeof(Unsigned) * CHAR_BIT;
+			static constexpr Wide low_mask = Wide(~Unsigned{});
+
+			Wide magic;
+			Unsigned divisor;
+
+			// top half of wide * narrow, without needing an even wider type
+			static constexpr Unsigned high(Wide wide, Unsigned narrow) noexcept
+			{
+				Wide bottom = ((wide & low_mask) * narrow) >> half_bits;
+				Wide top = (wide >> half_bits) * narrow;
+				return Unsigned((top + bottom) >> half_bits);
+			}
+
+			public:
+			constexpr explicit fastmod(Unsigned d) noexcept :
+				// overflows to 0 for d == 1, which works out for remainder
+				magic(~Wide{} / d + 1),
+				divisor(d)
+			{}
+
+			constexpr Unsigned remainder(Unsigned x) const noexcept
+			{ return high(magic * x, divisor); }
+
+			constexpr Unsigned quotient(Unsigned x) const noexcept
+			{ return divisor == 1 ? x : high(magic, x); }
+		};
+
+		template <typename Unsigned, typename = std::nullptr_t>
+		struct fastmod_select { using type = void; };
+
+		template <typename Unsigned>
+		struct fastmod_select<Unsigned, std::enable_if_t<
+			sizeof(Unsigned) <= sizeof(std::uint32_t), std::nullptr_t>>
+		{ using type = fastmod<std::uint32_t, std::uint64_t>; };
+
+	#if defined __SIZEOF_INT128__
+		__extension__ using uint128_t = unsigned __int128;
+		template <typename Unsigned>
+		struct fastmod_select<Unsigned, std::enable_if_t<
+			sizeof(Unsigned) == sizeof(std::uint64_t), std::nullptr_t>>
+		{ using type = fastmod<std::uint64_t, uint128_t>; };
+	#endif
+
+		template <typename Int, typename = std::nullptr_t>
+		struct has_fastdiv : std::false_type {};
+		template <typename Int>
+		struct has_fastdiv<Int, std::enable_if_t<
+			std::is_integral_v<Int> && not std::is_same_v<Int, bool>, std::nullptr_t>>
+		: std::bool_constant<not std::is_void_v<
+			typename fastmod_select<std::make_unsigned_t<Int>>::type>> {};
+		template <typename Int>
+		constexpr bool has_fastdiv_v = has_fastdiv<Int>::value;
+
+		// / and % with a precomputed divisor, truncating towards zero like the built in ones,
+		// so for signed we work on magnitudes and fix up the sign
+		template <typename Int>
+		class fastdiv
+		{
+			using unsigned_t = std::make_unsigned_t<Int>;
+			using fastmod = typename fastmod_select<unsigned_t>::type;
+
+			fastmod mod;
+			bool negative_divisor;
+
+			static constexpr unsigned_t magnitude(Int x) noexcept
+			{
+				if constexpr (std::is_signed_v<Int>)
+					return x < 0 ? -unsigned_t(x) : unsigned_t(x);
+				else
+					return x;
+			}
+
+			public:
+			constexpr explicit fastdiv(Int d) noexcept :
+				mod(magnitude(d)),
+				negative_divisor(d < 0)
+			{}
+
+			constexpr Int remainder(Int x) const noexcept
+			{
+				Int remainder = mod.remainder(magnitude(x));
+				return x < 0 ? -remainder : remainder;
+			}
+
+			constexpr Int quotient(Int x) const noexcept
+			{
+				unsigned_t quotient = mod.quotient(magnitude(x));
+				return (x < 0) != negative_divisor ? Int(-quotient) : Int(quotient);
+			}
+		};
+
+	} // namespace detail
+
+} // namespace simple::support
+
+#endif /* end of include guard */
@@ -1,14 +1,43 @@
 #ifndef SIMPLE_SUPPORT_MATH_FLOAT_HPP
 #define SIMPLE_SUPPORT_MATH_FLOAT_HPP
 
+#include <cassert>
+#include <climits>
 #include <cstddef>
 #include <cstdint>
 #include <type_traits>
 #include <limits>
+#include <cstring>
+#include <iterator>
+
+#include "../algorithm/traits.hpp"
+
+#if defined __has_builtin
+#if __has_builtin(__builtin_bit_cast)
+#define SIMPLE_SUPPORT_MATH_BUILTIN_BIT_CAST
+#endif
+#endif
 
 namespace simple::support
 {
 
+	// std::bit_cast is c++20, the builtin is there earlier and is constexpr
+	template <typename To, typename From>
+	[[nodiscard]] constexpr
+	To bit_cast(const From& from) noexcept
+	{
+		static_assert(sizeof(To) == sizeof(From));
+		static_assert(std::is_trivially_copyable_v<To>);
+		static_assert(std::is_trivially_copyable_v<From>);
+#if defined SIMPLE_SUPPORT_MATH_BUILTIN_BIT_CAST
+		return __builtin_bit_cast(To, from);
+#else
+		To to{};
+		std::memcpy(&to, &from, sizeof(To)); // not constexpr, nothing to do about it
+		return to;
+#endif
+	}
+
 	template <typename Number>
 	[[nodiscard]] constexpr
 	Number abs(Number n) noexcept(noexcept(Number(n > 0 ? n : -n)))
@@ -38,6 +67,131 @@ namespace simple::support
 		return equal_ulp(x,y,1);
 	}
 
+	namespace detail
+	{
+
+		template <typename Float, typename = std::nullptr_t>
+		struct float_bits {};
+
+		template <typename Float>
+		struct float_bits<Float, std::enable_if_t<
+			std::numeric_limits<Float>::is_iec559 &&
+			sizeof(Float) == sizeof(std::uint32_t)
+		, decltype(nullptr)>>
+		{ using type = std::uint32_t; };
+
+		template <typename Float>
+		struct float_bits<Float, std::enable_if_t<
+			std::numeric_limits<Float>::is_iec559 &&
+			sizeof(Float) == sizeof(std::uint64_t)
+		, decltype(nullptr)>>
+		{ using type = std::uint64_t; };
+
+		template <typename Float>
+		using float_bits_t = typename float_bits<Float>::type;
+
+		// maps the floats to unsigned integers preserving the order,
+		// so that adjacent floats map to adjacent integers,
+		// and both zeros map to the same one
+		// negative: sign - magnitude, positive: sign + magnitude
+		// no branches here, so that loops over it can be vectorized
+		template <typename Float>
+		constexpr float_bits_t<Float> ordered_bits(Float x) noexcept
+		{
+			using bits_t = float_bits_t<Float>;
+			constexpr bits_t sign = bits_t{1} << (sizeof(bits_t) * CHAR_BIT - 1);
+			const bits_t bits = bit_cast<bits_t>(x);
+			const bits_t magnitude = bits & ~sign;
+			const bits_t negative = bits_t{0} - (bits >> (sizeof(bits_t) * CHAR_BIT - 1));
+			return sign + ((magnitude ^ negative) - negative);
+		}
+
+		template <typename Float>
+		constexpr float_bits_t<Float> is_nan_mask(Float x) noexcept
+		{
+			using bits_t = float_bits_t<Float>;
+			constexpr bits_t sign = bits_t{1} << (sizeof(bits_t) * CHAR_BIT - 1);
+			constexpr bits_t infinity = bit_cast<bits_t>(std::numeric_limits<Float>::infinity());
+			return bits_t{0} - bits_t((bit_cast<bits_t>(x) & ~sign) > infinity);
+		}
+
+	} // namespace detail
+
+	// number of representable values between x and y,
+	// max value if any one of them is nan
+	template <typename Float>
+	[[nodiscard]] constexpr
+	detail::float_bits_t<Float> ulp_distance(Float x, Float y) noexcept
+	{
+		const auto a = detail::ordered_bits(x);
+		const auto b = detail::ordered_bits(y);
+		return (a > b ? a - b : b - a)
+			| detail::is_nan_mask(x) | detail::is_nan_mask(y);
+	}
+
+	struct ulp_comparison
+	{
+		std::size_t mismatches;
+		std::size_t first_mismatch; // same as size if no mismatches
+		std::uintmax_t max_distance;
+
+		[[nodiscard]] constexpr
+		explicit operator bool() const noexcept
+		{ return mismatches == 0; }
+	};
+
+	// compares elementwise, counting values that are more than ulp apart,
+	// in one pass over the data
+	template <typename It, typename OtherIt>
+	[[nodiscard]] constexpr
+	ulp_comparison compare_ulp(It begin, It end, OtherIt other, std::uintmax_t ulp)
+	{
+		using float_t = typename std::iterator_traits<It>::value_type;
+		using bits_t = detail::float_bits_t<float_t>;
+
+		const std::size_t size = end - begin;
+		ulp_comparison result{0, size, 0};
+
+		// inner loop has no branches and can be vectorized,
+		// we only go back to look for first mismatch once
+		constexpr std::size_t block_size = 64;
+		bits_t max_distance = 0;
+		for(std::size_t block = 0; block < size; block += block_size)
+		{
+			const std::size_t block_end = size - block < block_size ? size : block + block_size;
+			std::size_t mismatches = 0;
+			for(std::size_t i = block; i != block_end; ++i)
+			{
+				const bits_t distance = ulp_distance<float_t>(begin[i], other[i]);
+				mismatches += distance > ulp;
+				max_distance = distance > max_distance ? distance : max_distance;
+			}
+
+			if(mismatches != 0 && result.mismatches == 0)
+			{
+				std::size_t i = block;
+				while(!(ulp_distance<float_t>(begin[i], other[i]) > ulp))
+					++i;
+				result.first_mismatch = i;
+			}
+			result.mismatches += mismatches;
+		}
+		result.max_distance = max_distance;
+
+		return result;
+	}
+
+	template <typename Range, typename OtherRange,
+		std::enable_if_t<is_range_v<Range> && is_range_v<OtherRange>>* = nullptr>
+	[[nodiscard]] constexpr
+	ulp_comparison compare_ulp(const Range& range, const OtherRange& other, std::uintmax_t ulp)
+	{
+		using std::begin;
+		using std::end;
+		assert(end(range) - begin(range) == end(other) - begin(other));
+		return compare_ulp(begin(range), end(range), begin(other), ulp);
+	}
+
 	template <typename Float, typename IntMax = std::intmax_t>
 	[[nodiscard]] constexpr
 	Float trunc_up_to_intmax(Float f)
@@ -0,0 +1,55 @@
+#ifndef SIMPLE_SUPPORT_MATH_GCD_HPP
+#define SIMPLE_SUPPORT_MATH_GCD_HPP
+
+#include <type_traits>
+
+#include "../bits.hpp"
+
+namespace simple::support
+{
+
+	// Stein's binary gcd, subtractions and shifts instead of divisions,
+	// gcd(0,0) = 0 and the result is never negative
+	// (except for gcd(min, min) or gcd(min, 0) that don't fit)
+	template <typename Int, std::enable_if_t<std::is_integral_v<Int>>* = nullptr>
+	[[nodiscard]] constexpr Int gcd(Int one, Int other) noexcept
+	{
+		using unsigned_t = std::make_unsigned_t<Int>;
+		auto abs = [](Int x) -> unsigned_t { return x < 0 ? unsigned_t(0) - unsigned_t(x) : unsigned_t(x); };
+		unsigned_t a = abs(one), b = abs(other);
+		if(a == 0)
+			return Int(b);
+		if(b == 0)
+			return Int(a);
+
+		// common powers of two
+		const int shift = count_trailing_zeros(unsigned_t(a | b));
+		a >>= count_trailing_zeros(a);
+		do
+		{
+			// both odd from here on, so the difference is even
+			b >>= count_trailing_zeros(b);
+			if(a > b)
+			{
+				const unsigned_t t = a;
+				a = b;
+				b = t;
+			}
+			b -= a;
+		}
+		while(b != 0);
+		return Int(unsigned_t(a << shift));
+	}
+
+	template <typename Int, std::enable_if_t<std::is_integral_v<Int>>* = nullptr>
+	[[nodiscard]] constexpr Int lcm(Int one, Int other) noexcept
+	{
+		if(one == 0 || other == 0)
+			return Int(0);
+		const Int result = one / gcd(one, other) * other;
+		return result < 0 ? Int(-result) : result;
+	}
+
+} // namespace simple::support
+
+#endif /* end of include guard */
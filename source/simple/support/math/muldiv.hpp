@@ -0,0 +1,121 @@
+#ifndef SIMPLE_SUPPORT_MATH_MULDIV_HPP
+#define SIMPLE_SUPPORT_MATH_MULDIV_HPP
+
+#include <cassert>
+#include <climits>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include "../wide_int.hpp"
+#include "../algorithm/traits.hpp"
+#include "../type_traits.hpp"
+#include "fastdiv.hpp"
+
+namespace simple::support
+{
+
+	enum class rounding
+	{
+		toward_zero, // same as builtin division
+		floor,
+		ceil,
+		nearest // ties away from zero
+	};
+
+	namespace detail
+	{
+
+		// magnitude of the quotient of a double width product, and the remainder
+		template <typename Unsigned>
+		constexpr Unsigned muldiv_magnitude(Unsigned one, Unsigned other, Unsigned divisor, Unsigned& remainder) noexcept
+		{
+			static_assert(std::is_unsigned_v<Unsigned> && sizeof(Unsigned) <= sizeof(std::uint64_t),
+				"muldiv is only implemented for up to 64 bit integers.");
+			if constexpr (sizeof(Unsigned) < sizeof(std::uint64_t))
+			{
+				// the product always fits, and so does the quotient, unless the divisor is 1,
+				// it's up to the caller to check the range
+				const std::uint64_t product = std::uint64_t(one) * other;
+				remainder = Unsigned(product % divisor);
+				assert(product / divisor <= std::uint64_t(std::numeric_limits<Unsigned>::max()) && "muldiv result out of range.");
+				return Unsigned(product / divisor);
+			}
+			else
+			{
+				// uses __int128 internally when available
+				auto product = full_product(std::uint64_t(one), std::uint64_t(other));
+				remainder = product.divide(divisor);
+				assert(product.words[1] == 0 && "muldiv result out of range.");
+				return product.words[0];
+			}
+		}
+
+		template <rounding Mode, typename Unsigned>
+		constexpr Unsigned round_magnitude(Unsigned quotient, Unsigned remainder, Unsigned divisor, bool negative) noexcept
+		{
+			bool up = false;
+			if constexpr (Mode == rounding::floor)
+				up = negative && remainder != 0;
+			else if constexpr (Mode == rounding::ceil)
+				up = !negative && remainder != 0;
+			else if constexpr (Mode == rounding::nearest)
+				up = remainder >= divisor - remainder; // 2r >= d without overflow
+			assert((!up || quotient != std::numeric_limits<Unsigned>::max()) && "muldiv result out of range.");
+			return quotient + up;
+		}
+
+	} // namespace detail
+
+	// one * other / divisor, as if computed with infinite precision and then rounded,
+	// the result must fit in Int
+	template <rounding Mode = rounding::toward_zero, typename Int,
+		std::enable_if_t<std::is_integral_v<Int>>* = nullptr>
+	[[nodiscard]] constexpr Int muldiv(Int one, Int other, Int divisor) noexcept
+	{
+		assert(divisor != 0 && "Division by zero.");
+		using unsigned_t = std::make_unsigned_t<Int>;
+		if constexpr (std::is_signed_v<Int>)
+		{
+			const bool negative = ((one < 0) != (other < 0)) != (divisor < 0);
+			// negating in unsigned works for min too
+			auto abs = [](Int x) -> unsigned_t { return x < 0 ? unsigned_t(0) - unsigned_t(x) : unsigned_t(x); };
+			const unsigned_t abs_divisor = abs(divisor);
+			unsigned_t remainder = 0;
+			const unsigned_t truncated = detail::muldiv_magnitude(abs(one), abs(other), abs_divisor, remainder);
+			const unsigned_t quotient = detail::round_magnitude<Mode>(truncated, remainder, abs_divisor, negative);
+			assert(quotient <= unsigned_t(std::numeric_limits<Int>::max()) + negative && "muldiv result out of range.");
+			return Int(negative ? unsigned_t(0) - quotient : quotient);
+		}
+		else
+		{
+			unsigned_t remainder = 0;
+			const unsigned_t quotient = detail::muldiv_magnitude<unsigned_t>(one, other, divisor, remainder);
+			return detail::round_magnitude<Mode>(quotient, remainder, unsigned_t(divisor), false);
+		}
+	}
+
+	// scales a sequence by the ratio multiplier/divisor
+	template <rounding Mode = rounding::toward_zero, typename It, typename OutIt,
+		typename Int = typename std::iterator_traits<It>::value_type>
+	constexpr OutIt muldiv(It begin, It end, OutIt out, const non_deduced<Int>& multiplier, const non_deduced<Int>& divisor)
+	{
+		for(; begin != end; ++begin, ++out)
+			*out = muldiv<Mode>(Int(*begin), multiplier, divisor);
+		return out;
+	}
+
+	template <rounding Mode = rounding::toward_zero, typename Range, typename OutIt,
+		typename Int = std::remove_cv_t<std::remove_reference_t<decltype(*std::begin(std::declval<const Range&>()))>>,
+		std::enable_if_t<is_range_v<Range>>* = nullptr>
+	constexpr OutIt muldiv(const Range& range, OutIt out, const non_deduced<Int>& multiplier, const non_deduced<Int>& divisor)
+	{
+		using std::begin;
+		using std::end;
+		return muldiv<Mode>(begin(range), end(range), out, multiplier, divisor);
+	}
+
+} // namespace simple::support
+
+#endif /* end of include guard */
@@ -2,9 +2,11 @@
 #define SIMPLE_SUPPORT_MATH_ROOT_HPP
 
 #include <cassert>
+#include <cstdint>
 #include <limits>
 #include <type_traits>
 #include "../range.hpp"
+#include "../arithmetic.hpp"
 #include "../algorithm.hpp"
 #include "float.hpp"
 
@@ -38,11 +40,152 @@ namespace simple::support
 		return g;
 	}
 
+	// same, but gives up after max_iterations,
+	// in case eq is too picky for the precision we've got
+	template <typename Number, typename EqualityCheck>
+	[[nodiscard]] constexpr
+	Number babelonian_root2(Number n, Number g,
+		EqualityCheck eq, int max_iterations)
+	{
+		assert(n >= 0 && g > 0 && max_iterations > 0);
+		do
+			g = average(g, n/g);
+		while( !eq(n, g*g) && --max_iterations > 0 );
+		return g;
+	}
+
+	namespace detail
+	{
+
+		template <int Power, typename Number>
+		constexpr Number power(Number x) noexcept
+		{
+			Number result = x;
+			for(int i = 1; i < Power; ++i)
+				result *= x;
+			return result;
+		}
+
+		template <typename Float>
+		constexpr bool has_bit_estimate = std::numeric_limits<Float>::is_iec559 &&
+			(sizeof(Float) == sizeof(std::uint32_t) || sizeof(Float) == sizeof(std::uint64_t));
+
+		// positive normal numbers only
+		template <typename Float>
+		constexpr bool can_estimate_root(Float n) noexcept
+		{
+			return std::numeric_limits<Float>::min() <= n && n <= std::numeric_limits<Float>::max();
+		}
+
+		template <typename Float>
+		struct root_guess
+		{
+			Float value;
+			int correct_bits;
+		};
+
+		// this one works for any floating point type, but only gets the power of 2 right,
+		// finding it by galloping with squares
+		template <int N, typename Float>
+		constexpr root_guess<Float> exponent_root_estimate(Float n) noexcept
+		{
+			const Float base = power<N>(Float{2});
+			Float estimate = 1;
+			while(n < Float{1})
+			{
+				Float small = base;
+				Float small_root = 2;
+				// squaring small could overflow, so dividing twice instead
+				while(n * small < Float{1} / small)
+				{
+					small *= small;
+					small_root *= small_root;
+				}
+				n *= small;
+				estimate /= small_root;
+			}
+			while(n >= base)
+			{
+				Float big = base;
+				Float big_root = 2;
+				while(big <= n / big)
+				{
+					big *= big;
+					big_root *= big_root;
+				}
+				n /= big;
+				estimate *= big_root;
+			}
+			// n is in [1, 2^N) now, so the root of it is in [1,2)
+			return {estimate, 1};
+		}
+
+		// the binary representation of a floating point number is,
+		// more or less, a piecewise linear approximation of its logarithm
+		// (exponent being the integer part, and mantissa the fractional part),
+		// so dividing it by N is more or less taking the Nth root,
+		// after taking out the bias of the exponent, which is the representation of 1
+		//
+		// for square root the relative error of this is under 1/16
+		// other types borrow the estimate from double if they can
+		template <int N, typename Float>
+		constexpr root_guess<Float> root_estimate(Float n) noexcept
+		{
+			assert(can_estimate_root(n));
+			if constexpr (has_bit_estimate<Float>)
+			{
+				using bits_t = std::conditional_t<sizeof(Float) == sizeof(std::uint32_t),
+					std::int32_t, std::int64_t>;
+				constexpr bits_t one = bit_cast<bits_t>(Float{1});
+				return {bit_cast<Float>((bit_cast<bits_t>(n) - one) / N + one), 4};
+			}
+			else if constexpr (has_bit_estimate<double>)
+			{
+				if(can_estimate_root(static_cast<double>(n)) &&
+					static_cast<double>(n) < std::numeric_limits<double>::max())
+				{
+					auto guess = root_estimate<N>(static_cast<double>(n));
+					return {static_cast<Float>(guess.value), guess.correct_bits};
+				}
+				// otherwise take out the power of 2 first, what's left is in range of double,
+				// a single bit is not enough to start Newton's method for N > 2,
+				// the first step overshoots by about 2^(N-1)/N, and it's a long way down from there
+				auto exponent = exponent_root_estimate<N>(n);
+				auto guess = root_estimate<N>(static_cast<double>(n / power<N>(exponent.value)));
+				return {exponent.value * static_cast<Float>(guess.value), guess.correct_bits};
+			}
+			return exponent_root_estimate<N>(n);
+		}
+
+		// each step of Babylonian method squares the relative error
+		// (e -> e*e/2(1+e), and since e >= -1/2, e*e/2(1+e) <= e*e)
+		// so the number of correct bits at least doubles,
+		// plus one last step to let the rounding settle
+		template <typename Float>
+		constexpr int root2_iteration_bound(int correct_bits) noexcept
+		{
+			int iterations = 1;
+			for(; correct_bits < std::numeric_limits<Float>::digits; correct_bits *= 2)
+				++iterations;
+			return iterations;
+		}
+
+	} // namespace detail
+
+	// iterates until eq is satisfied, however long that takes,
+	// the estimate only gets it there faster
 	template <typename Number, typename EqualityCheck>
 	[[nodiscard]] constexpr
 	Number babelonian_root2(Number n, EqualityCheck eq)
 	{
-		// the number itself is a good neutral initial guess
+		if constexpr (std::is_floating_point_v<Number>)
+		{
+			if(detail::can_estimate_root(n))
+				return babelonian_root2(n, detail::root_estimate<2>(n).value,
+					std::forward<EqualityCheck>(eq));
+		}
+
+		// otherwise the number itself is a good neutral initial guess
 		// not biased towards large or small numbers
 		return babelonian_root2(n, n,
 			std::forward<EqualityCheck>(eq));
@@ -61,7 +204,11 @@ namespace simple::support
 		using limits = std::numeric_limits<Number>;
 		if(n!=n || abs(n) < limits::min() || abs(n) == limits::infinity()) return n; // hand rolled std::isnormal
 
-		return babelonian_root2(n, almost_equal<Number>);
+		// almost_equal can be too picky for the last bit,
+		// so stop once the estimate can't get any more correct
+		auto guess = detail::root_estimate<2>(n);
+		return babelonian_root2(n, guess.value, almost_equal<Number>,
+			detail::root2_iteration_bound<Number>(guess.correct_bits));
 	}
 
 
@@ -122,6 +269,219 @@ namespace simple::support
 #undef simple_support_math__builtin_sqrt
 #undef simple_support_math__builtin_sqrtl
 
+	namespace detail
+	{
+
+		// one bit of the root at a time, from the top
+		template <typename Unsigned>
+		constexpr Unsigned bitwise_isqrt(Unsigned n) noexcept
+		{
+			Unsigned root = 0;
+			Unsigned bit = Unsigned{1} << (std::numeric_limits<Unsigned>::digits - 2);
+			while(bit > n)
+				bit >>= 2;
+			while(bit != 0)
+			{
+				if(n >= root + bit)
+				{
+					n -= root + bit;
+					root = (root >> 1) + bit;
+				}
+				else
+					root >>= 1;
+				bit >>= 2;
+			}
+			return root;
+		}
+
+	} // namespace detail
+
+	// floor of the square root, exact
+	template <typename Int,
+		std::enable_if_t<std::is_integral_v<Int>>* = nullptr>
+	[[nodiscard]] constexpr
+	Int isqrt(Int n) noexcept
+	{
+		assert(n >= 0);
+		using unsigned_t = std::make_unsigned_t<Int>;
+		constexpr int digits = std::numeric_limits<unsigned_t>::digits;
+		const auto un = static_cast<unsigned_t>(n);
+
+		if constexpr (digits > std::numeric_limits<unsigned long long>::digits)
+		{
+			return static_cast<Int>(detail::bitwise_isqrt(un));
+		}
+		else
+		{
+			// largest root that can be squared without overflow
+			constexpr unsigned_t max_root = unsigned_t(~unsigned_t{}) >> (digits / 2);
+
+			// double is exact up to 52 bits, past that the estimate can be off by one,
+			// either way corrected below
+			auto root = static_cast<unsigned_t>(root2(static_cast<double>(un)));
+			if(root > max_root)
+				root = max_root;
+			while(static_cast<unsigned_t>(root * root) > un)
+				--root;
+			while(root < max_root && static_cast<unsigned_t>((root + 1) * (root + 1)) <= un)
+				++root;
+			return static_cast<Int>(root);
+		}
+	}
+
+	// the infamous fast inverse square root,
+	// a good initial guess from the magic of the floating point representation
+	// refined with some steps of Newton's method
+	// each step roughly doubles the number of correct bits, starting from about 4
+	template <int Steps = 1, typename Float,
+		std::enable_if_t<std::is_floating_point_v<Float>>* = nullptr>
+	[[nodiscard]] constexpr
+	Float rsqrt(Float x) noexcept
+	{
+		static_assert(Steps >= 0);
+		using limits = std::numeric_limits<Float>;
+		if constexpr (limits::is_iec559 && sizeof(Float) == sizeof(std::uint32_t))
+		{
+			auto y = bit_cast<Float>(std::uint32_t{0x5f37'5a86} - (bit_cast<std::uint32_t>(x) >> 1));
+			for(int i = 0; i < Steps; ++i)
+				y *= Float(1.5) - Float(0.5) * x * y * y;
+			return y;
+		}
+		else if constexpr (limits::is_iec559 && sizeof(Float) == sizeof(std::uint64_t))
+		{
+			auto y = bit_cast<Float>(std::uint64_t{0x5fe6'eb50'c7b5'37a9} - (bit_cast<std::uint64_t>(x) >> 1));
+			for(int i = 0; i < Steps; ++i)
+				y *= Float(1.5) - Float(0.5) * x * y * y;
+			return y;
+		}
+		else
+			return Float{1} / root2(x);
+	}
+
+	namespace detail
+	{
+
+		// Newton's method, generalization of Babylonian,
+		// from above the root it descends monotonically,
+		// so we stop as soon as it doesn't
+		template <int N, typename Float>
+		constexpr Float newton_root(Float n) noexcept
+		{
+			auto step = [n](Float g)
+			{ return (Float{N - 1} * g + n / power<N - 1>(g)) / Float{N}; };
+
+			auto guess = root_estimate<N>(n);
+			// after one step we're above the root regardless of the estimate (AM-GM)
+			Float g = step(guess.value);
+			// convergence is slower than for square root, so a few more for good measure,
+			// we should never get there
+			for(int i = root2_iteration_bound<Float>(guess.correct_bits) + 2; i > 0; --i)
+			{
+				Float next = step(g);
+				if(!(next < g))
+					break;
+				g = next;
+			}
+			return g;
+		}
+
+		template <int N, typename Unsigned>
+		constexpr Unsigned integer_root(Unsigned n) noexcept
+		{
+			if(n < 2)
+				return n;
+
+			int bit_width = 0;
+			for(Unsigned x = n; x != 0; x >>= 1)
+				++bit_width;
+			// 2^ceil(width/N) is above the root
+			Unsigned g = Unsigned{1} << ((bit_width + N - 1) / N);
+
+			while(true)
+			{
+				// g^(N-1) might overflow, in which case n/g^(N-1) is 0
+				Unsigned g_power = 1;
+				bool overflow = false;
+				for(int i = 1; i < N && !overflow; ++i)
+					overflow = mul_overflow(g_power, g);
+				Unsigned next = ((N - 1) * g + (overflow ? 0 : n / g_power)) / N;
+				if(!(next < g))
+					return g;
+				g = next;
+			}
+		}
+
+	} // namespace detail
+
+	// Nth root, floor of it for integers
+	template <int N, typename Number,
+		std::enable_if_t<std::is_arithmetic_v<Number>>* = nullptr>
+	[[nodiscard]] constexpr
+	Number root(Number n) noexcept
+	{
+		static_assert(N > 0, "Zeroth root is a bit too much.");
+		if constexpr (N == 1)
+			return n;
+		else if constexpr (std::is_integral_v<Number>)
+		{
+			if constexpr (N == 2)
+				return isqrt(n);
+			else
+			{
+				using unsigned_t = std::make_unsigned_t<Number>;
+				if constexpr (std::is_signed_v<Number>)
+				{
+					assert(N % 2 == 1 || n >= 0);
+					if(n < 0)
+						return -Number(detail::integer_root<N>(unsigned_t(-unsigned_t(n))));
+				}
+				return Number(detail::integer_root<N>(unsigned_t(n)));
+			}
+		}
+		else if constexpr (N == 2)
+			return root2(n);
+		else
+		{
+			using limits = std::numeric_limits<Number>;
+			if(n < -Number{0})
+				return N % 2 == 1 ? -root<N>(-n) : Number{0}/Number{0};
+			if(n != n || n == Number{0} || n == limits::infinity())
+				return n;
+
+			// subnormal, scale by a power of 2 that we can take the root of exactly
+			Number factor = 1;
+			for(int i = 0; i < (limits::digits + N - 1) / N; ++i)
+				factor *= 2;
+			const Number scale = detail::power<N>(factor);
+			Number root_scale = 1;
+			while(n < limits::min())
+			{
+				n *= scale;
+				root_scale /= factor;
+			}
+
+			return detail::newton_root<N>(n) * root_scale;
+		}
+	}
+
+	template <typename Range, typename OutIt,
+		std::enable_if_t<is_range_v<Range>>* = nullptr>
+	constexpr OutIt isqrt(const Range& range, OutIt out)
+	{
+		for(auto&& n : range)
+			*out++ = isqrt(n);
+		return out;
+	}
+
+	template <int Steps = 1, typename Range, typename OutIt,
+		std::enable_if_t<is_range_v<Range>>* = nullptr>
+	constexpr OutIt rsqrt(const Range& range, OutIt out)
+	{
+		for(auto&& x : range)
+			*out++ = rsqrt<Steps>(x);
+		return out;
+	}
+
 } // namespace simple::support
 
 #endif /* end of include guard */
@@ -5,10 +5,17 @@
 #include <limits>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <optional>
+#include <charconv>
+#include <system_error>
 #include <cinttypes>
+#include <cerrno>
+#include <cassert>
+#include <cstdint>
 
 #include "range.hpp"
+#include "arithmetic.hpp"
 #include "algorithm/utils.hpp"
 
 namespace simple::support
@@ -55,78 +62,391 @@ namespace simple::support
 		}
 	}
 
+	namespace detail::parse
+	{
+
+		// same as std::isspace in the C locale
+		constexpr bool is_space(char c) noexcept
+		{ return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+		// 36 for anything that's not a digit in any base
+		constexpr unsigned digit_value(char c) noexcept
+		{
+			if(c >= '0' && c <= '9')
+				return unsigned(c - '0');
+			if(c >= 'a' && c <= 'z')
+				return unsigned(c - 'a' + 10);
+			if(c >= 'A' && c <= 'Z')
+				return unsigned(c - 'A' + 10);
+			return 36;
+		}
+
+		struct integer
+		{
+			std::uintmax_t magnitude = 0;
+			bool negative = false;
+			bool overflow = false;
+			const char* end = nullptr; // begin if nothing was parsed
+		};
+
+		// eight characters as a little endian word, the compiler turns this into a single load
+		constexpr std::uint64_t load_eight(const char* chars) noexcept
+		{
+			std::uint64_t word = 0;
+			for(int i = 0; i < 8; ++i)
+				word |= std::uint64_t(static_cast<unsigned char>(chars[i])) << (8 * i);
+			return word;
+		}
+
+		constexpr bool all_eight_digits(std::uint64_t word) noexcept
+		{
+			// high nibbles are all 3, and adding 6 doesn't carry out of the low ones
+			return ((word & 0xf0f0'f0f0'f0f0'f0f0) |
+				(((word + 0x0606'0606'0606'0606) & 0xf0f0'f0f0'f0f0'f0f0) >> 4)) ==
+				0x3333'3333'3333'3333;
+		}
+
+		// SWAR, combines adjacent digits pairwise, 8 -> 4 -> 2 -> 1,
+		// with three multiplications
+		constexpr std::uint32_t eight_digits_value(std::uint64_t word) noexcept
+		{
+			constexpr std::uint64_t mask = 0x0000'00ff'0000'00ff;
+			constexpr std::uint64_t mul1 = 100 + (1'000'000ull << 32);
+			constexpr std::uint64_t mul2 = 1 + (10'000ull << 32);
+			word -= 0x3030'3030'3030'3030;
+			word = (word * 10) + (word >> 8);
+			return std::uint32_t((((word & mask) * mul1) + (((word >> 16) & mask) * mul2)) >> 32);
+		}
+
+		// decimal digits 8 at a time, while there's no chance of overflow,
+		// the rest is left for the scalar loop
+		constexpr const char* parse_eight_digits(const char* current, const char* end, integer& result) noexcept
+		{
+			constexpr std::uintmax_t safe = (std::numeric_limits<std::uintmax_t>::max() - 99'999'999) / 100'000'000;
+			while(end - current >= 8 && result.magnitude <= safe)
+			{
+				const std::uint64_t word = load_eight(current);
+				if(!all_eight_digits(word))
+					break;
+				result.magnitude = result.magnitude * 100'000'000 + eight_digits_value(word);
+				current += 8;
+				result.end = current;
+			}
+			return current;
+		}
+
+		// the format of strtol with base 0: leading space, sign,
+		// 0x for hex and 0 for octal prefix
+		constexpr integer parse_integer(const char* const begin, const char* const end) noexcept
+		{
+			integer result{};
+			result.end = begin;
+			const char* current = begin;
+			while(current != end && is_space(*current))
+				++current;
+			if(current != end && (*current == '-' || *current == '+'))
+			{
+				result.negative = *current == '-';
+				++current;
+			}
+
+			unsigned base = 10;
+			if(current != end && *current == '0')
+			{
+				// a lone 0 is parsed even if no digits follow
+				result.end = current + 1;
+				base = 8;
+				if(end - current > 2 && (current[1] == 'x' || current[1] == 'X') && digit_value(current[2]) < 16)
+				{
+					base = 16;
+					current += 2;
+				}
+			}
+
+			if(base == 10)
+				current = parse_eight_digits(current, end, result);
+
+			for(; current != end; ++current)
+			{
+				const unsigned digit = digit_value(*current);
+				if(digit >= base)
+					break;
+				result.overflow |= mul_overflow(result.magnitude, std::uintmax_t{base});
+				result.overflow |= add_overflow(result.magnitude, std::uintmax_t{digit});
+				result.end = current + 1;
+			}
+			return result;
+		}
+
+		// narrows to N, clamping out of range values same as strtoimax/strtoumax
+		template <typename N>
+		constexpr std::errc to_integer(const integer& parsed, N& value) noexcept
+		{
+			using limits = std::numeric_limits<N>;
+			if constexpr (std::is_signed_v<N>)
+			{
+				const std::uintmax_t limit = parsed.negative
+					? std::uintmax_t(0) - std::uintmax_t(limits::min())
+					: std::uintmax_t(limits::max());
+				if(parsed.overflow || parsed.magnitude > limit)
+				{
+					value = parsed.negative ? limits::min() : limits::max();
+					return std::errc::result_out_of_range;
+				}
+				value = N(parsed.negative ? std::uintmax_t(0) - parsed.magnitude : parsed.magnitude);
+			}
+			else
+			{
+				// negative unsigned values wrap around, same as strtoumax
+				const std::uintmax_t wrapped = parsed.negative
+					? std::uintmax_t(0) - parsed.magnitude
+					: parsed.magnitude;
+				if(parsed.overflow || wrapped > std::uintmax_t(limits::max()))
+				{
+					value = limits::max();
+					return std::errc::result_out_of_range;
+				}
+				value = N(wrapped);
+			}
+			return std::errc{};
+		}
+
+		// std::from_chars with the format of strtod: leading space, plus sign and 0x for hex
+		template <typename Float>
+		std::from_chars_result parse_float(const char* const begin, const char* const end, Float& value) noexcept
+		{
+			const char* current = begin;
+			while(current != end && is_space(*current))
+				++current;
+			bool negative = false;
+			if(current != end && (*current == '-' || *current == '+'))
+			{
+				negative = *current == '-';
+				++current;
+			}
+			// from_chars takes a minus itself, but we already had a sign
+			if(current == end || *current == '-' || *current == '+')
+				return {begin, std::errc::invalid_argument};
+
+			std::from_chars_result result{};
+			if(end - current > 2 && current[0] == '0' && (current[1] == 'x' || current[1] == 'X'))
+			{
+				// from_chars would also take a sign, inf or nan here
+				const char* digits = current + 2;
+				const bool hex = digit_value(digits[0]) < 16 ||
+					(digits[0] == '.' && end - digits > 1 && digit_value(digits[1]) < 16);
+				if(hex)
+					result = std::from_chars(digits, end, value, std::chars_format::hex);
+				else
+				{
+					// just the 0 then
+					value = Float(0);
+					result = {current + 1, std::errc{}};
+				}
+			}
+			else
+				result = std::from_chars(current, end, value);
+
+			if(result.ec == std::errc::invalid_argument)
+				return {begin, result.ec};
+			if(negative)
+				value = -value;
+			return result;
+		}
+
+	} // namespace detail::parse
+
+	// locale free, doesn't need null termination, and reports errors instead of setting errno,
+	// accepts the same format as the char* version:
+	// leading whitespace, a sign, and base prefixes for integers (0x, 0) and hex floats (0x),
+	// on error the end pointer is begin, except for out of range,
+	// where integers are clamped and floats are left unchanged,
+	// subnormal floats are not an error, unlike with strtod
+	template <typename N>
+	std::from_chars_result strton(const char* begin, const char* end, N& value) noexcept
+	{
+		static_assert(std::is_arithmetic_v<N>, "simple::support::strton expects an arithmetic type!");
+		if constexpr (std::is_floating_point_v<N>)
+			return detail::parse::parse_float(begin, end, value);
+		else
+		{
+			const auto parsed = detail::parse::parse_integer(begin, end);
+			if(parsed.end == begin)
+				return {begin, std::errc::invalid_argument};
+			return {parsed.end, detail::parse::to_integer(parsed, value)};
+		}
+	}
+
+	// lower bound, any delimiter character, and upper bound,
+	// where a ':' delimiter means the upper bound is an offset from the lower,
+	// on error the end pointer is begin and the value is left unchanged,
+	// otherwise it points past the upper bound, so ranges can be read one after another
+	template <typename N>
+	std::from_chars_result strton(const char* begin, const char* end, range<N>& value) noexcept
+	{
+		static_assert(std::is_arithmetic_v<N>, "simple::support::strton expects an arithmetic type!");
+		range<N> result{};
+		const auto lower = strton(begin, end, result.lower());
+		if(std::errc{} != lower.ec)
+			return {begin, lower.ec};
+		if(lower.ptr == end)
+			return {begin, std::errc::invalid_argument};
+		const char delimiter = *lower.ptr;
+		const auto upper = strton(lower.ptr + 1, end, result.upper());
+		if(std::errc{} != upper.ec)
+			return {begin, upper.ec};
+		if(':' == delimiter)
+			result.upper() += result.lower();
+		value = result;
+		return {upper.ptr, std::errc{}};
+	}
+
+	template <typename N>
+	std::from_chars_result strton(std::string_view s, N& value) noexcept
+	{
+		return strton(s.data(), s.data() + s.size(), value);
+	}
+
+	// throws out_of_range and invalid_argument, like std::stoi and std::stod,
+	// except that a subnormal float result is returned instead of being out of range
 	template <typename N>
-	N ston(const std::string& s, std::size_t * start_end_index)
+	N ston(std::string_view s, std::size_t * start_end_index)
 	{
 		static_assert(std::is_arithmetic_v<N>, "simple::support::ston expects an arithmetic type!");
-		errno = 0;
-		const char* start = s.c_str() + (start_end_index ? *start_end_index : 0);
-		char* end;
-		N result = strton<N>(start, &end);
-		if(ERANGE == errno)
+		const std::size_t start = start_end_index ? *start_end_index : 0;
+		if(start > s.size())
 			throw std::out_of_range("simple::support::ston");
-		auto diff = end - start;
-		if(!diff)
+		N result{};
+		const auto [end, error] = strton(s.data() + start, s.data() + s.size(), result);
+		if(std::errc::result_out_of_range == error)
+			throw std::out_of_range("simple::support::ston");
+		if(std::errc{} != error)
 			throw std::invalid_argument("simple::support::ston");
 		if(start_end_index)
-			*start_end_index += diff;
+			*start_end_index = end - s.data();
 		return result;
 	}
 
 	template <typename N>
-	N ston(const std::string& s, std::size_t start_index = 0)
+	N ston(std::string_view s, std::size_t start_index = 0)
 	{
 		return ston<N>(s, &start_index);
 	}
 
+	// nullopt on any error, subnormal floats included in the result as with ston
 	template <typename Number>
-	std::optional<Number> to_(const std::string& s)
+	std::optional<Number> to_(std::string_view s)
 	{
 		static_assert(std::is_arithmetic_v<Number>, "simple::support::to_<Number> expects an arithmetic type!");
-		errno = 0;
-		const char* start = s.c_str();
-		char* end;
-		Number result = strton<Number>(start, &end);
-		if(ERANGE == errno)
-			return std::nullopt;
-		auto diff = end - start;
-		if(!diff)
+		Number result{};
+		if(strton(s, result).ec != std::errc{})
 			return std::nullopt;
 		return result;
 	}
 
 	template <typename N>
-	range<N> storn(const std::string& s, std::size_t * start_end_index)
+	range<N> storn(std::string_view s, std::size_t * start_end_index)
 	{
 		static_assert(std::is_arithmetic_v<N>, "simple::support::storn expects an arithmetic type!");
+		const std::size_t start = start_end_index ? *start_end_index : 0;
+		if(start > s.size())
+			throw std::out_of_range("simple::support::storn");
 		range<N> result{};
-		std::size_t j = start_end_index ? *start_end_index : 0;
-		result.lower() = ston<N>(s, &j);
-		if(j == s.size())
+		const auto [end, error] = strton(s.data() + start, s.data() + s.size(), result);
+		if(std::errc::result_out_of_range == error)
+			throw std::out_of_range("simple::support::storn");
+		if(std::errc{} != error)
 			throw std::invalid_argument("simple::support::storn");
-		auto delim = s[j];
-		++j;
-		result.upper() = ston<N>(s, &j);
-		if(':' == delim)
-			result.upper() += result.lower();
 		if(start_end_index)
-			*start_end_index = j;
+			*start_end_index = end - s.data();
 		return result;
 	}
 
 	template <typename N>
-	range<N> storn(const std::string& s, std::size_t start_index = 0)
+	range<N> storn(std::string_view s, std::size_t start_index = 0)
 	{
 		return storn<N>(s, &start_index);
 	}
 
+	namespace detail::parse
+	{
+		template <typename N>
+		struct field
+		{
+			static N parse(std::string_view s) { return ston<N>(s); }
+		};
+
+		template <typename N>
+		struct field<range<N>>
+		{
+			static range<N> parse(std::string_view s) { return storn<N>(s); }
+		};
+	} // namespace detail::parse
+
+	// parses every field between separators, same as split followed by ston
+	// (or storn for ranges) on each field,
+	// so throws the same exceptions, including for empty fields,
+	// separators are found with memchr (through string_view::find)
+	// and decimal digits are converted eight at a time
+	template <typename N, typename OutIt>
+	OutIt parse_numbers(std::string_view text, std::string_view separator, OutIt out)
+	{
+		assert(!separator.empty());
+		std::size_t start = 0;
+		while(true)
+		{
+			const std::size_t found = text.find(separator, start);
+			const std::size_t field_end = found == std::string_view::npos ? text.size() : found;
+			*out++ = detail::parse::field<N>::parse(text.substr(start, field_end - start));
+			if(found == std::string_view::npos)
+				return out;
+			start = found + separator.size();
+		}
+	}
+
+	template <typename N, typename OutIt>
+	OutIt parse_numbers(std::string_view text, char separator, OutIt out)
+	{
+		return parse_numbers<N>(text, std::string_view(&separator, 1), out);
+	}
+
+	// same format as to_string below, written into a caller provided buffer,
+	// floating point bounds are written in the shortest form that reads back the same,
+	// like std::to_chars on error ptr is last and ec is value_too_large
 	template <typename N>
-	std::string to_string(range<N> r, const char& separator = '-')
+	std::to_chars_result to_chars(char* first, char* last, range<N> r, char separator = '-') noexcept
 	{
-		using std::to_string;
+		static_assert(std::is_arithmetic_v<N>, "simple::support::to_chars expects an arithmetic type!");
 		if(':' == separator)
 			r.upper() -= r.lower();
-		return to_string(r.lower()) + separator + to_string(r.upper());
+		const auto lower = std::to_chars(first, last, r.lower());
+		if(std::errc{} != lower.ec)
+			return lower;
+		if(lower.ptr == last)
+			return {last, std::errc::value_too_large};
+		*lower.ptr = separator;
+		return std::to_chars(lower.ptr + 1, last, r.upper());
+	}
+
+	template <typename N>
+	std::string to_string(range<N> r, const char& separator = '-')
+	{
+		// std::to_chars is deleted for bool
+		if constexpr (std::is_integral_v<N> && not std::is_same_v<N, bool>)
+		{
+			// sign and digits for each bound, and the separator
+			char buffer[2 * (std::numeric_limits<N>::digits10 + 2) + 1];
+			const auto [end, error] = to_chars(buffer, buffer + sizeof(buffer), r, separator);
+			assert(std::errc{} == error);
+			return std::string(buffer, end);
+		}
+		else
+		{
+			using std::to_string;
+			if(':' == separator)
+				r.upper() -= r.lower();
+			return to_string(r.lower()) + separator + to_string(r.upper());
+		}
 	}
 
 	template <typename It>
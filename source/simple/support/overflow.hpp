@@ -0,0 +1,421 @@
+#ifndef SIMPLE_SUPPORT_OVERFLOW_HPP
+#define SIMPLE_SUPPORT_OVERFLOW_HPP
+
+#include <cassert>
+#include <climits>
+#include <limits>
+#include <iterator>
+#include <type_traits>
+
+#include "arithmetic.hpp"
+#include "algorithm/traits.hpp"
+
+namespace simple::support
+{
+
+	namespace detail
+	{
+
+		// arithmetic.hpp only does signed types if signed overflow is assumed to wrap,
+		// here they're done through unsigned arithmetic when there are no builtins
+		template <typename Int>
+		constexpr bool add_overflows(Int& result, Int one, Int two) noexcept
+		{
+			if constexpr (std::is_unsigned_v<Int>)
+				return add_overflow(result, one, two);
+			else
+			{
+#if !defined SIMPLE_ARITHMETIC_OVERFLOW_FALLBACK
+				return __builtin_add_overflow(one, two, &result);
+#else
+				using unsigned_t = std::make_unsigned_t<Int>;
+				result = Int(unsigned_t(unsigned_t(one) + unsigned_t(two)));
+				// overflow if both have the sign that the result doesn't
+				return ((one ^ result) & (two ^ result)) < 0;
+#endif
+			}
+		}
+
+		template <typename Int>
+		constexpr bool sub_overflows(Int& result, Int one, Int two) noexcept
+		{
+			if constexpr (std::is_unsigned_v<Int>)
+				return sub_overflow(result, one, two);
+			else
+			{
+#if !defined SIMPLE_ARITHMETIC_OVERFLOW_FALLBACK
+				return __builtin_sub_overflow(one, two, &result);
+#else
+				using unsigned_t = std::make_unsigned_t<Int>;
+				result = Int(unsigned_t(unsigned_t(one) - unsigned_t(two)));
+				// overflow if the signs differ, and the result's sign is not the first one's
+				return ((one ^ two) & (one ^ result)) < 0;
+#endif
+			}
+		}
+
+		template <typename Int>
+		constexpr bool mul_overflows(Int& result, Int one, Int two) noexcept
+		{
+			if constexpr (std::is_unsigned_v<Int>)
+				return mul_overflow(result, one, two);
+			else
+			{
+#if !defined SIMPLE_ARITHMETIC_OVERFLOW_FALLBACK
+				return __builtin_mul_overflow(one, two, &result);
+#else
+				using unsigned_t = std::make_unsigned_t<Int>;
+				using wide_t = std::common_type_t<unsigned_t, unsigned>;
+				result = Int(unsigned_t(wide_t(unsigned_t(one)) * wide_t(unsigned_t(two))));
+				constexpr Int min = std::numeric_limits<Int>::min();
+				if((one == -1 && two == min) || (two == -1 && one == min))
+					return true;
+				return two != 0 && result / two != one;
+#endif
+			}
+		}
+
+		template <typename Int>
+		constexpr Int wrapping_negate(Int one) noexcept
+		{
+			using unsigned_t = std::make_unsigned_t<Int>;
+			return Int(unsigned_t(unsigned_t{0} - unsigned_t(one)));
+		}
+
+		// what the result would be if there were no limits, clamped to the limits
+		template <typename Int>
+		constexpr Int saturation(bool negative) noexcept
+		{
+			return negative ? std::numeric_limits<Int>::min() : std::numeric_limits<Int>::max();
+		}
+
+		// branchless versions for batch operations, so that compilers can vectorize them
+		template <typename Int>
+		constexpr Int saturating_add(Int one, Int two) noexcept
+		{
+			using limits = std::numeric_limits<Int>;
+			if constexpr (sizeof(Int) < sizeof(int))
+			{
+				const int result = int(one) + int(two);
+				return Int(result < limits::min() ? limits::min() : result > limits::max() ? limits::max() : result);
+			}
+			else if constexpr (std::is_unsigned_v<Int>)
+			{
+				const Int result = one + two;
+				return result | (Int{0} - Int(result < one));
+			}
+			else
+			{
+				using unsigned_t = std::make_unsigned_t<Int>;
+				const Int result = Int(unsigned_t(one) + unsigned_t(two));
+				const Int saturated = Int(unsigned_t(limits::max()) + (unsigned_t(one) >> limits::digits));
+				return ((one ^ result) & (two ^ result)) < 0 ? saturated : result;
+			}
+		}
+
+		template <typename Int>
+		constexpr Int saturating_sub(Int one, Int two) noexcept
+		{
+			using limits = std::numeric_limits<Int>;
+			if constexpr (sizeof(Int) < sizeof(int))
+			{
+				const int result = int(one) - int(two);
+				return Int(result < limits::min() ? limits::min() : result > limits::max() ? limits::max() : result);
+			}
+			else if constexpr (std::is_unsigned_v<Int>)
+			{
+				const Int result = one - two;
+				return result & (Int{0} - Int(result <= one));
+			}
+			else
+			{
+				using unsigned_t = std::make_unsigned_t<Int>;
+				const Int result = Int(unsigned_t(one) - unsigned_t(two));
+				const Int saturated = Int(unsigned_t(limits::max()) + (unsigned_t(one) >> limits::digits));
+				return ((one ^ two) & (one ^ result)) < 0 ? saturated : result;
+			}
+		}
+
+	} // namespace detail
+
+// comparisons are the same for all of these
+#define SIMPLE_SUPPORT_OVERFLOW_COMPARISON(type, op_sym) \
+	[[nodiscard]] friend constexpr bool operator op_sym (const type& one, const type& other) noexcept \
+	{ return one.raw op_sym other.raw; }
+
+#define SIMPLE_SUPPORT_OVERFLOW_COMPARISONS(type) \
+	SIMPLE_SUPPORT_OVERFLOW_COMPARISON(type, ==) \
+	SIMPLE_SUPPORT_OVERFLOW_COMPARISON(type, !=) \
+	SIMPLE_SUPPORT_OVERFLOW_COMPARISON(type, <) \
+	SIMPLE_SUPPORT_OVERFLOW_COMPARISON(type, <=) \
+	SIMPLE_SUPPORT_OVERFLOW_COMPARISON(type, >) \
+	SIMPLE_SUPPORT_OVERFLOW_COMPARISON(type, >=)
+
+// in place operators in terms of binary ones
+#define SIMPLE_SUPPORT_OVERFLOW_IN_PLACE(type, op_sym) \
+	friend constexpr type& operator op_sym##= (type& one, const type& other) noexcept \
+	{ return one = one op_sym other; }
+
+#define SIMPLE_SUPPORT_OVERFLOW_IN_PLACE_OPERATORS(type) \
+	SIMPLE_SUPPORT_OVERFLOW_IN_PLACE(type, +) \
+	SIMPLE_SUPPORT_OVERFLOW_IN_PLACE(type, -) \
+	SIMPLE_SUPPORT_OVERFLOW_IN_PLACE(type, *) \
+	SIMPLE_SUPPORT_OVERFLOW_IN_PLACE(type, /) \
+	SIMPLE_SUPPORT_OVERFLOW_IN_PLACE(type, %)
+
+	// modular arithmetic, for signed types as well
+	template <typename Int>
+	class wrapping
+	{
+		static_assert(std::is_integral_v<Int> && not std::is_same_v<Int, bool>,
+			"Overflow policies are only for integers.");
+
+		public:
+		using value_type = Int;
+
+		constexpr wrapping() noexcept = default;
+		constexpr wrapping(Int value) noexcept : raw(value) {}
+
+		[[nodiscard]] constexpr Int value() const noexcept { return raw; }
+		[[nodiscard]] constexpr explicit operator Int() const noexcept { return raw; }
+
+		[[nodiscard]] friend constexpr wrapping operator+(wrapping one, wrapping other) noexcept
+		{ return Int(unsigned_t(one.raw) + unsigned_t(other.raw)); }
+
+		[[nodiscard]] friend constexpr wrapping operator-(wrapping one, wrapping other) noexcept
+		{ return Int(unsigned_t(one.raw) - unsigned_t(other.raw)); }
+
+		[[nodiscard]] friend constexpr wrapping operator*(wrapping one, wrapping other) noexcept
+		{ return Int(unsigned_t(wide_t(unsigned_t(one.raw)) * wide_t(unsigned_t(other.raw)))); }
+
+		// only min / -1 overflows
+		[[nodiscard]] friend constexpr wrapping operator/(wrapping one, wrapping other) noexcept
+		{
+			assert(other.raw != 0);
+			if constexpr (std::is_signed_v<Int>)
+				if(other.raw == -1)
+					return detail::wrapping_negate(one.raw);
+			return Int(one.raw / other.raw);
+		}
+
+		[[nodiscard]] friend constexpr wrapping operator%(wrapping one, wrapping other) noexcept
+		{
+			assert(other.raw != 0);
+			if constexpr (std::is_signed_v<Int>)
+				if(other.raw == -1)
+					return Int{0};
+			return Int(one.raw % other.raw);
+		}
+
+		[[nodiscard]] friend constexpr wrapping operator-(wrapping one) noexcept
+		{ return detail::wrapping_negate(one.raw); }
+
+		SIMPLE_SUPPORT_OVERFLOW_IN_PLACE_OPERATORS(wrapping)
+		SIMPLE_SUPPORT_OVERFLOW_COMPARISONS(wrapping)
+
+		private:
+		using unsigned_t = std::make_unsigned_t<Int>;
+		// small types get promoted to int, which can overflow on multiplication
+		using wide_t = std::common_type_t<unsigned_t, unsigned>;
+		Int raw = 0;
+	};
+
+	// clamps to the limits on overflow
+	template <typename Int>
+	class saturating
+	{
+		static_assert(std::is_integral_v<Int> && not std::is_same_v<Int, bool>,
+			"Overflow policies are only for integers.");
+
+		public:
+		using value_type = Int;
+
+		constexpr saturating() noexcept = default;
+		constexpr saturating(Int value) noexcept : raw(value) {}
+
+		[[nodiscard]] constexpr Int value() const noexcept { return raw; }
+		[[nodiscard]] constexpr explicit operator Int() const noexcept { return raw; }
+
+		[[nodiscard]] friend constexpr saturating operator+(saturating one, saturating other) noexcept
+		{
+			Int result{};
+			return detail::add_overflows(result, one.raw, other.raw)
+				? detail::saturation<Int>(other.raw < Int{0}) : result;
+		}
+
+		[[nodiscard]] friend constexpr saturating operator-(saturating one, saturating other) noexcept
+		{
+			Int result{};
+			return detail::sub_overflows(result, one.raw, other.raw)
+				? detail::saturation<Int>(std::is_unsigned_v<Int> || other.raw > Int{0}) : result;
+		}
+
+		[[nodiscard]] friend constexpr saturating operator*(saturating one, saturating other) noexcept
+		{
+			Int result{};
+			return detail::mul_overflows(result, one.raw, other.raw)
+				? detail::saturation<Int>((one.raw < Int{0}) != (other.raw < Int{0})) : result;
+		}
+
+		[[nodiscard]] friend constexpr saturating operator/(saturating one, saturating other) noexcept
+		{
+			assert(other.raw != 0);
+			if constexpr (std::is_signed_v<Int>)
+				if(other.raw == -1)
+					return -one;
+			return Int(one.raw / other.raw);
+		}
+
+		[[nodiscard]] friend constexpr saturating operator%(saturating one, saturating other) noexcept
+		{
+			assert(other.raw != 0);
+			if constexpr (std::is_signed_v<Int>)
+				if(other.raw == -1)
+					return Int{0};
+			return Int(one.raw % other.raw);
+		}
+
+		[[nodiscard]] friend constexpr saturating operator-(saturating one) noexcept
+		{ return saturating{Int{0}} - one; }
+
+		SIMPLE_SUPPORT_OVERFLOW_IN_PLACE_OPERATORS(saturating)
+		SIMPLE_SUPPORT_OVERFLOW_COMPARISONS(saturating)
+
+		private:
+		Int raw = 0;
+	};
+
+	// remembers if overflow ever happened on the way to the value,
+	// without branching on it
+	template <typename Int>
+	class checked
+	{
+		static_assert(std::is_integral_v<Int> && not std::is_same_v<Int, bool>,
+			"Overflow policies are only for integers.");
+
+		public:
+		using value_type = Int;
+
+		constexpr checked() noexcept = default;
+		constexpr checked(Int value) noexcept : raw(value) {}
+
+		[[nodiscard]] constexpr bool valid() const noexcept { return !overflowed; }
+
+		[[nodiscard]] constexpr Int value() const noexcept
+		{
+			assert(valid() && "Value must not have overflown.");
+			return raw;
+		}
+
+		[[nodiscard]] constexpr Int value_or(Int fallback) const noexcept
+		{ return valid() ? raw : fallback; }
+
+		[[nodiscard]] constexpr explicit operator Int() const noexcept { return value(); }
+
+		[[nodiscard]] friend constexpr checked operator+(checked one, checked other) noexcept
+		{
+			checked result;
+			result.overflowed = detail::add_overflows(result.raw, one.raw, other.raw)
+				| one.overflowed | other.overflowed;
+			return result;
+		}
+
+		[[nodiscard]] friend constexpr checked operator-(checked one, checked other) noexcept
+		{
+			checked result;
+			result.overflowed = detail::sub_overflows(result.raw, one.raw, other.raw)
+				| one.overflowed | other.overflowed;
+			return result;
+		}
+
+		[[nodiscard]] friend constexpr checked operator*(checked one, checked other) noexcept
+		{
+			checked result;
+			result.overflowed = detail::mul_overflows(result.raw, one.raw, other.raw)
+				| one.overflowed | other.overflowed;
+			return result;
+		}
+
+		// division by zero and min / -1 count as overflow
+		[[nodiscard]] friend constexpr checked operator/(checked one, checked other) noexcept
+		{
+			checked result;
+			const bool invalid = other.raw == 0 || overflowing_division(one.raw, other.raw);
+			result.raw = invalid ? Int{0} : Int(one.raw / other.raw);
+			result.overflowed = invalid | one.overflowed | other.overflowed;
+			return result;
+		}
+
+		[[nodiscard]] friend constexpr checked operator%(checked one, checked other) noexcept
+		{
+			checked result;
+			const bool invalid = other.raw == 0 || overflowing_division(one.raw, other.raw);
+			result.raw = invalid ? Int{0} : Int(one.raw % other.raw);
+			result.overflowed = invalid | one.overflowed | other.overflowed;
+			return result;
+		}
+
+		[[nodiscard]] friend constexpr checked operator-(checked one) noexcept
+		{ return checked{Int{0}} - one; }
+
+		SIMPLE_SUPPORT_OVERFLOW_IN_PLACE_OPERATORS(checked)
+		SIMPLE_SUPPORT_OVERFLOW_COMPARISONS(checked)
+
+		private:
+		Int raw = 0;
+		bool overflowed = false;
+
+		static constexpr bool overflowing_division(Int one, Int other) noexcept
+		{
+			if constexpr (std::is_signed_v<Int>)
+				return one == std::numeric_limits<Int>::min() && other == -1;
+			else
+				return false;
+		}
+	};
+
+#undef SIMPLE_SUPPORT_OVERFLOW_IN_PLACE_OPERATORS
+#undef SIMPLE_SUPPORT_OVERFLOW_IN_PLACE
+#undef SIMPLE_SUPPORT_OVERFLOW_COMPARISONS
+#undef SIMPLE_SUPPORT_OVERFLOW_COMPARISON
+
+	// batch versions over plain integers, with no branches so that they can be vectorized
+	template <typename It, typename OtherIt, typename OutIt>
+	constexpr OutIt saturating_add(It begin, It end, OtherIt other, OutIt out)
+	{
+		using int_t = typename std::iterator_traits<It>::value_type;
+		for(; begin != end; ++begin, ++other, ++out)
+			*out = detail::saturating_add<int_t>(*begin, *other);
+		return out;
+	}
+
+	template <typename It, typename OtherIt, typename OutIt>
+	constexpr OutIt saturating_sub(It begin, It end, OtherIt other, OutIt out)
+	{
+		using int_t = typename std::iterator_traits<It>::value_type;
+		for(; begin != end; ++begin, ++other, ++out)
+			*out = detail::saturating_sub<int_t>(*begin, *other);
+		return out;
+	}
+
+	template <typename Range, typename OtherRange, typename OutIt,
+		std::enable_if_t<is_range_v<Range> && is_range_v<OtherRange>>* = nullptr>
+	constexpr OutIt saturating_add(const Range& range, const OtherRange& other, OutIt out)
+	{
+		using std::begin;
+		using std::end;
+		return saturating_add(begin(range), end(range), begin(other), out);
+	}
+
+	template <typename Range, typename OtherRange, typename OutIt,
+		std::enable_if_t<is_range_v<Range> && is_range_v<OtherRange>>* = nullptr>
+	constexpr OutIt saturating_sub(const Range& range, const OtherRange& other, OutIt out)
+	{
+		using std::begin;
+		using std::end;
+		return saturating_sub(begin(range), end(range), begin(other), out);
+	}
+
+} // namespace simple::support
+
+#endif /* end of include guard */
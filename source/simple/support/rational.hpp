@@ -1,7 +1,20 @@
 #ifndef SIMPLE_SUPPORT_RATIONAL_HPP
 #define SIMPLE_SUPPORT_RATIONAL_HPP
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
 #include "type_traits.hpp"
+#include "overflow.hpp"
+#include "wide_int.hpp"
+#include "math/float.hpp"
+#include "math/gcd.hpp"
+#include "math/muldiv.hpp"
+#include "algorithm/traits.hpp"
+#include "int_literals.hpp"
 
 namespace simple::support
 {
@@ -23,13 +36,123 @@ namespace simple::support
 	{
 		static constexpr T value = Value;
 
-		constexpr operator T() { return value; };
+		constexpr operator T() const { return value; };
 	};
 
 	template <typename T, T left, T right>
 	constexpr auto operator* (meta_constant<T, left>, meta_constant<T, right>)
 	{ return meta_constant<T, left * right>{}; }
 
+	// denominator policy, a runtime denominator like void,
+	// but kept in lowest terms with a positive denominator,
+	// optionally recording (sticky) overflow of any operation
+	template <bool CheckOverflow = false>
+	struct normalized {};
+
+	namespace detail::rational_traits
+	{
+		template <typename Denom>
+		struct is_normalized : std::false_type {};
+		template <bool CheckOverflow>
+		struct is_normalized<normalized<CheckOverflow>> : std::true_type {};
+		template <typename Denom>
+		constexpr bool is_normalized_v = is_normalized<Denom>::value;
+
+		template <typename Denom>
+		constexpr bool checks_overflow_v = std::is_same_v<Denom, normalized<true>>;
+
+		template <typename Denom>
+		constexpr bool runtime_denominator_v = std::is_same_v<Denom, void> || is_normalized_v<Denom>;
+
+		// sign of one * other - one_other * other_other, without overflow
+		template <typename Num>
+		constexpr int compare_products(const Num& one, const Num& other, const Num& one_other, const Num& other_other)
+		{
+			if constexpr (std::is_integral_v<Num> && sizeof(Num) <= sizeof(std::int32_t))
+			{
+				using wide = std::conditional_t<std::is_signed_v<Num>, std::int64_t, std::uint64_t>;
+				const wide left = wide(one) * wide(other), right = wide(one_other) * wide(other_other);
+				return (right < left) - (left < right);
+			}
+			else if constexpr (std::is_integral_v<Num> && sizeof(Num) <= sizeof(std::int64_t))
+			{
+				// sign extended, so the truncated product is exact
+				using wide = std::conditional_t<std::is_signed_v<Num>, wide_int<128>, wide_uint<128>>;
+				const wide left = wide(one) * wide(other), right = wide(one_other) * wide(other_other);
+				return (right < left) - (left < right);
+			}
+			else
+			{
+				const auto left = one * other, right = one_other * other_other;
+				return (right < left) - (left < right);
+			}
+		}
+
+		template <typename Num>
+		constexpr bool negative(const Num& x)
+		{
+			if constexpr (std::is_unsigned_v<Num>)
+				return false;
+			else
+				return x < Num{};
+		}
+
+		template <typename Num, typename Denom, typename = std::nullptr_t>
+		struct has_fast_denominator : std::false_type {};
+		template <typename Num, typename Denom>
+		struct has_fast_denominator<Num, Denom, std::enable_if_t<
+			std::is_integral_v<Num> && not std::is_same_v<Num, bool> &&
+			not runtime_denominator_v<Denom>, std::nullptr_t>>
+		: std::bool_constant<(Denom::value > 0 &&
+			std::uintmax_t(Denom::value) <= std::uintmax_t(std::numeric_limits<std::make_unsigned_t<Num>>::max()))> {};
+		template <typename Num, typename Denom>
+		constexpr bool has_fast_denominator_v = has_fast_denominator<Num, Denom>::value;
+
+		// division by a compile time denominator, on magnitudes,
+		// a shift for powers of two, and a multiplication by precomputed inverse otherwise,
+		// the denominator only needs to fit the unsigned type, so that 2^15 works for Q15 in int16
+		template <typename Num, typename Denom>
+		struct fast_denominator
+		{
+			using unsigned_t = std::make_unsigned_t<Num>;
+			static constexpr unsigned_t divisor = unsigned_t(Denom::value);
+			static constexpr bool power_of_two = (divisor & unsigned_t(divisor - 1)) == 0;
+
+			static constexpr unsigned_t quotient(unsigned_t x, unsigned_t& remainder) noexcept
+			{
+				if constexpr (power_of_two)
+				{
+					remainder = unsigned_t(x & unsigned_t(divisor - 1));
+					return unsigned_t(x >> count_trailing_zeros(divisor));
+				}
+				else if constexpr (support::detail::has_fastdiv_v<unsigned_t>)
+				{
+					constexpr support::detail::fastdiv<unsigned_t> inverse(divisor);
+					const unsigned_t result = inverse.quotient(x);
+					remainder = unsigned_t(x - result * divisor);
+					return result;
+				}
+				else
+				{
+					remainder = unsigned_t(x % divisor);
+					return unsigned_t(x / divisor);
+				}
+			}
+
+			template <rounding Mode>
+			static constexpr Num divide(Num x) noexcept
+			{
+				const bool negative = rational_traits::negative(x);
+				const unsigned_t magnitude = negative ? unsigned_t(unsigned_t(0) - unsigned_t(x)) : unsigned_t(x);
+				unsigned_t remainder = 0;
+				const unsigned_t truncated = quotient(magnitude, remainder);
+				const unsigned_t result = round_magnitude<Mode>(truncated, remainder, divisor, negative);
+				return Num(negative ? unsigned_t(unsigned_t(0) - result) : result);
+			}
+		};
+
+	} // namespace detail::rational_traits
+
 	template <typename Num, typename Denom>
 	struct rational_base
 	{
@@ -45,6 +168,21 @@ namespace simple::support
 		Num den;
 	};
 
+	template <typename Num>
+	struct rational_base<Num, normalized<false>>
+	{
+		Num num;
+		Num den;
+	};
+
+	template <typename Num>
+	struct rational_base<Num, normalized<true>>
+	{
+		Num num;
+		Num den;
+		bool overflow = false;
+	};
+
 
 	template <typename Num, typename Denom = void>
 	class rational : private rational_base<Num, Denom>
@@ -59,18 +197,33 @@ namespace simple::support
 
 		constexpr rational& operator*=(const Num& value)
 		{
-			numerator() *= value;
+			if constexpr (detail::rational_traits::is_normalized_v<Denom>)
+			{
+				// cross cancel, to stay in lowest terms without reducing the product
+				const Num common = gcd(value, denominator());
+				multiply(numerator(), value / common);
+				denominator() /= common;
+				if(detail::rational_traits::negative(denominator()))
+					flip_signs();
+			}
+			else
+				numerator() *= value;
 			return *this;
 		}
 
+		// adding integers can't introduce common factors
 		constexpr rational& operator+=(const Num& other)
 		{
-			numerator() += other * denominator();
+			Num scaled = other;
+			multiply(scaled, denominator());
+			add(numerator(), scaled);
 			return *this;
 		}
 		constexpr rational& operator-=(const Num& other)
 		{
-			numerator() -= other * denominator();
+			Num scaled = other;
+			multiply(scaled, denominator());
+			subtract(numerator(), scaled);
 			return *this;
 		}
 
@@ -91,20 +244,46 @@ namespace simple::support
 		}
 
 		constexpr explicit operator Num() const
-		{ return numerator() / denominator(); }
+		{
+			if constexpr (detail::rational_traits::has_fast_denominator_v<Num, Denom>)
+				return detail::rational_traits::fast_denominator<Num, Denom>::template divide<rounding::toward_zero>(numerator());
+			else
+				return numerator() / denominator();
+		}
+
+		// integer closest to the ratio in the direction of the rounding mode
+		template <rounding Mode = rounding::toward_zero>
+		[[nodiscard]] constexpr Num round() const
+		{
+			static_assert(std::is_integral_v<Num>, "Only integers can be rounded.");
+			if constexpr (detail::rational_traits::has_fast_denominator_v<Num, Denom>)
+				return detail::rational_traits::fast_denominator<Num, Denom>::template divide<Mode>(numerator());
+			else
+				return muldiv<Mode>(numerator(), Num{1}, Num(denominator()));
+		}
+
+		// same as Num(value * ratio), but the intermediate product can't overflow
+		template <rounding Mode = rounding::toward_zero>
+		[[nodiscard]] constexpr Num scale(const Num& value) const
+		{
+			if constexpr (std::is_integral_v<Num>)
+				return muldiv<Mode>(value, numerator(), Num(denominator()));
+			else
+				return value * numerator() / denominator();
+		}
 
 		constexpr Num& numerator() &
 		{ return this->num; }
 		constexpr const Num& numerator() const &
 		{ return this->num; }
 		constexpr Num&& numerator() &&
-		{ return this->num; }
+		{ return std::move(this->num); }
 		constexpr const Num&& numerator() const &&
-		{ return this->num; }
+		{ return std::move(this->num); }
 
 		constexpr decltype(auto) denominator()
 		{
-			if constexpr (std::is_same_v<Denom,void>)
+			if constexpr (detail::rational_traits::runtime_denominator_v<Denom>)
 				return (this->den); // unknown denominator
 			else
 				return typename base::den{}; // known denominator
@@ -112,7 +291,7 @@ namespace simple::support
 
 		constexpr decltype(auto) denominator() const
 		{
-			if constexpr (std::is_same_v<Denom,void>)
+			if constexpr (detail::rational_traits::runtime_denominator_v<Denom>)
 				return (this->den); // unknown denominator
 			else
 				return typename base::den{}; // known denominator
@@ -121,9 +300,12 @@ namespace simple::support
 		// unknown denominator
 
 		template <typename Numerator,
-			typename D = Denom, std::enable_if_t<std::is_same_v<D,void>>* = nullptr >
+			typename D = Denom, std::enable_if_t<detail::rational_traits::runtime_denominator_v<D>>* = nullptr >
 		constexpr rational(Numerator numerator, Numerator denominator) : base{numerator, denominator}
-		{}
+		{
+			if constexpr (detail::rational_traits::is_normalized_v<Denom>)
+				normalize();
+		}
 
 		template <typename OtherNum, typename OtherDenom,
 			typename D = Denom, std::enable_if_t<std::is_same_v<D, void>>* = nullptr>
@@ -134,23 +316,177 @@ namespace simple::support
 			return *this;
 		}
 
+		// normalized denominator
+
+		// (a/b) * (c/d) = (a/g1 * c/g2) / (b/g2 * d/g1), where g1 = gcd(a,d) and g2 = gcd(c,b),
+		// if both are in lowest terms so is the result, and the products are as small as they can be
+		template <typename OtherDenom,
+			typename D = Denom, std::enable_if_t<detail::rational_traits::is_normalized_v<D>>* = nullptr>
+		constexpr rational& operator*=(const rational<Num, OtherDenom>& value)
+		{
+			const Num value_denominator = Num(value.denominator());
+			const Num common = gcd(numerator(), value_denominator);
+			const Num value_common = gcd(value.numerator(), denominator());
+			numerator() /= common;
+			denominator() /= value_common;
+			multiply(numerator(), value.numerator() / value_common);
+			multiply(denominator(), value_denominator / common);
+			if constexpr (detail::rational_traits::is_normalized_v<OtherDenom>)
+			{
+				if(detail::rational_traits::negative(denominator()))
+					flip_signs();
+			}
+			else
+				normalize();
+			return *this;
+		}
+
+		// a/b + c/d = (a * d/g + c * b/g) / (b/g * d), where g = gcd(b,d),
+		// then only the factors of g can be common with the numerator
+		template <typename OtherDenom,
+			typename D = Denom, std::enable_if_t<detail::rational_traits::is_normalized_v<D>>* = nullptr>
+		constexpr rational& operator+=(const rational<Num, OtherDenom>& value)
+		{
+			return accumulate(value, false);
+		}
+
+		template <typename OtherDenom,
+			typename D = Denom, std::enable_if_t<detail::rational_traits::is_normalized_v<D>>* = nullptr>
+		constexpr rational& operator-=(const rational<Num, OtherDenom>& value)
+		{
+			return accumulate(value, true);
+		}
+
+		// false if any operation overflowed, since construction or reset
+		template <typename D = Denom, std::enable_if_t<detail::rational_traits::checks_overflow_v<D>>* = nullptr>
+		[[nodiscard]] constexpr bool valid() const noexcept
+		{ return !this->overflow; }
+
+		template <typename D = Denom, std::enable_if_t<detail::rational_traits::checks_overflow_v<D>>* = nullptr>
+		constexpr void reset_overflow() noexcept
+		{ this->overflow = false; }
+
 		// known denominator
 
 		template <typename Denominator,
-			typename D = Denom, std::enable_if_t<not std::is_same_v<D,void>>* = nullptr >
+			typename D = Denom, std::enable_if_t<not detail::rational_traits::runtime_denominator_v<D>>* = nullptr >
 		constexpr rational(Num numerator, Denominator) : base{numerator}
 		{}
 
 
-		template <typename D = Denom, std::enable_if_t<not std::is_same_v<D, void>>* = nullptr>
+		template <typename D = Denom, std::enable_if_t<not detail::rational_traits::runtime_denominator_v<D>>* = nullptr>
 		constexpr rational& operator+=(const rational& other)
 		{
 			numerator() += other.numerator();
 			return *this;
 		}
 
+		private:
+
+		constexpr void multiply(Num& target, const Num& value)
+		{
+			if constexpr (detail::rational_traits::checks_overflow_v<Denom>)
+				this->overflow |= detail::mul_overflows<Num>(target, target, value);
+			else
+				target *= value;
+		}
+
+		constexpr void add(Num& target, const Num& value)
+		{
+			if constexpr (detail::rational_traits::checks_overflow_v<Denom>)
+				this->overflow |= detail::add_overflows<Num>(target, target, value);
+			else
+				target += value;
+		}
+
+		constexpr void subtract(Num& target, const Num& value)
+		{
+			if constexpr (detail::rational_traits::checks_overflow_v<Denom>)
+				this->overflow |= detail::sub_overflows<Num>(target, target, value);
+			else
+				target -= value;
+		}
+
+		constexpr void flip_signs()
+		{
+			if constexpr (detail::rational_traits::checks_overflow_v<Denom>)
+				this->overflow |= numerator() == std::numeric_limits<Num>::min()
+					|| denominator() == std::numeric_limits<Num>::min();
+			numerator() = -numerator();
+			denominator() = -denominator();
+		}
+
+		constexpr void normalize()
+		{
+			const Num common = gcd(numerator(), denominator());
+			if(common != Num{} + 1 && common != Num{})
+			{
+				numerator() /= common;
+				denominator() /= common;
+			}
+			if(detail::rational_traits::negative(denominator()))
+				flip_signs();
+		}
+
+		template <typename OtherDenom>
+		constexpr rational& accumulate(const rational<Num, OtherDenom>& value, bool negate)
+		{
+			const Num value_denominator = Num(value.denominator());
+			const Num common = gcd(denominator(), value_denominator);
+			Num other = value.numerator();
+			multiply(other, denominator() / common);
+			multiply(numerator(), value_denominator / common);
+			if(negate)
+				subtract(numerator(), other);
+			else
+				add(numerator(), other);
+			multiply(denominator(), value_denominator / common);
+			if constexpr (detail::rational_traits::is_normalized_v<OtherDenom>)
+			{
+				const Num reduce = gcd(numerator(), common);
+				if(reduce > Num{} + 1)
+				{
+					numerator() /= reduce;
+					denominator() /= reduce;
+				}
+				if(detail::rational_traits::negative(denominator()))
+					flip_signs();
+			}
+			else
+				normalize();
+			return *this;
+		}
+
 	};
 
+	// known denominator to another known denominator, rounded,
+	// the ratio of denominators is reduced at compile time,
+	// so for example /4 to /2 is just a division by 2, and /2 to /4 is a multiplication by 2
+	template <typename OtherDenom, rounding Mode = rounding::toward_zero, typename Num, typename Denom,
+		std::enable_if_t<detail::rational_traits::has_fast_denominator_v<Num, Denom> &&
+			detail::rational_traits::has_fast_denominator_v<Num, OtherDenom>>* = nullptr>
+	[[nodiscard]] constexpr rational<Num, OtherDenom> rational_cast(const rational<Num, Denom>& value)
+	{
+		using unsigned_t = std::make_unsigned_t<Num>;
+		constexpr unsigned_t from = unsigned_t(Denom::value), to = unsigned_t(OtherDenom::value);
+		constexpr unsigned_t common = gcd(from, to);
+		constexpr unsigned_t factor = to / common, divisor = from / common;
+		Num numerator = value.numerator();
+		if constexpr (factor != 1)
+		{
+			if constexpr (divisor != 1)
+			{
+				static_assert(divisor <= unsigned_t(std::numeric_limits<Num>::max()),
+					"Denominator ratio too large for a signed numerator.");
+				return rational<Num, OtherDenom>(muldiv<Mode>(numerator, Num(factor), Num(divisor)), OtherDenom{});
+			}
+			numerator *= Num(factor);
+		}
+		return rational<Num, OtherDenom>(
+			rational<Num, meta_constant<unsigned_t, divisor>>(numerator, meta_constant<unsigned_t, divisor>{}).template round<Mode>(),
+			OtherDenom{});
+	}
+
 	// unknown denominator
 	template <typename Num> rational(Num, Num) -> rational<Num, void>;
 
@@ -158,49 +494,85 @@ namespace simple::support
 	template <typename Num, typename Denom> rational(Num, Denom) -> rational<Num, Denom>;
 
 	template <typename Num, typename Denom,
-		std::enable_if_t<not std::is_same_v<Denom,void>>* = nullptr>
+		std::enable_if_t<not detail::rational_traits::runtime_denominator_v<Denom>>* = nullptr>
 	[[nodiscard]] constexpr
 	rational<Num, Denom> next(rational<Num,Denom> current)
 	{
 		current.numerator() += (Num{} + 1);
+		return current;
 	}
 	template <typename Num, typename Denom,
-		std::enable_if_t<not std::is_same_v<Denom,void>>* = nullptr>
+		std::enable_if_t<not detail::rational_traits::runtime_denominator_v<Denom>>* = nullptr>
 	[[nodiscard]] constexpr
 	rational<Num, Denom> prev(rational<Num,Denom> current)
 	{
 		current.numerator() -= (Num{} + 1);
+		return current;
 	}
 
 	template <typename Num, typename Denom,
-		std::enable_if_t<not std::is_same_v<Denom,void>>* = nullptr>
+		std::enable_if_t<not detail::rational_traits::runtime_denominator_v<Denom>>* = nullptr>
 	[[nodiscard]] constexpr
 	rational<Num, Denom> advance(rational<Num,Denom> current, Num offset)
 	{
 		current.numerator() += offset;
+		return current;
 	}
 
 	template <typename Num, typename Denom,
-		std::enable_if_t<not std::is_same_v<Denom,void>>* = nullptr>
+		std::enable_if_t<not detail::rational_traits::runtime_denominator_v<Denom>>* = nullptr>
 	[[nodiscard]] constexpr
 	bool operator== (const rational<Num,Denom>& one, const rational<Num,Denom>& other)
 	{ return one.numerator() == other.numerator(); }
 	template <typename Num, typename Denom,
-		std::enable_if_t<not std::is_same_v<Denom,void>>* = nullptr>
+		std::enable_if_t<not detail::rational_traits::runtime_denominator_v<Denom>>* = nullptr>
 	[[nodiscard]] constexpr
 	bool operator< (const rational<Num,Denom>& one, const rational<Num,Denom>& other)
 	{ return one.numerator() < other.numerator(); }
 
+	// runtime denominator, compared by cross multiplying in double width
+
+	template <typename Num, typename Denom,
+		std::enable_if_t<detail::rational_traits::runtime_denominator_v<Denom>>* = nullptr>
+	[[nodiscard]] constexpr
+	bool operator== (const rational<Num,Denom>& one, const rational<Num,Denom>& other)
+	{
+		if constexpr (detail::rational_traits::is_normalized_v<Denom>)
+			return one.numerator() == other.numerator() && one.denominator() == other.denominator();
+		else
+			return detail::rational_traits::compare_products(one.numerator(), other.denominator(),
+				other.numerator(), one.denominator()) == 0;
+	}
+
+	template <typename Num, typename Denom,
+		std::enable_if_t<detail::rational_traits::runtime_denominator_v<Denom>>* = nullptr>
+	[[nodiscard]] constexpr
+	bool operator< (const rational<Num,Denom>& one, const rational<Num,Denom>& other)
+	{
+		const int order = detail::rational_traits::compare_products(one.numerator(), other.denominator(),
+			other.numerator(), one.denominator());
+		// multiplied both sides by the denominators, which flip the order if negative
+		const bool flip = detail::rational_traits::negative(one.denominator()) != detail::rational_traits::negative(other.denominator());
+		return flip ? order > 0 : order < 0;
+	}
+
 	// common
 
 	template <typename Num, typename Denom>
 	constexpr auto operator*(const rational<Num,Denom>& multiplicand, const rational<Num,Denom>& multiplier)
 	{
-		return rational
-		(
-			multiplicand.numerator() * multiplier.numerator(),
-			multiplicand.denominator() * multiplier.denominator()
-		);
+		if constexpr (detail::rational_traits::is_normalized_v<Denom>)
+		{
+			auto product = multiplicand;
+			product *= multiplier;
+			return product;
+		}
+		else
+			return rational
+			(
+				multiplicand.numerator() * multiplier.numerator(),
+				multiplicand.denominator() * multiplier.denominator()
+			);
 	}
 
 	// TODO: there is some boost library that does this stuff...
@@ -237,6 +609,11 @@ namespace simple::support
 		-> decltype(addend += adder, rational<Num,Denom>{})
 	{ return addend += adder; }
 
+	template <typename Num, typename Denom>
+	constexpr auto operator-(rational<Num,Denom> minuend, const rational<Num,Denom>& subtrahend)
+		-> decltype(minuend -= subtrahend, rational<Num,Denom>{})
+	{ return minuend -= subtrahend; }
+
 	template <typename Num, typename Denom>
 	[[nodiscard]] constexpr
 	auto operator!=(rational<Num, Denom> one, rational<Num,Denom> other)
@@ -262,6 +639,235 @@ namespace simple::support
 	{ return !(left > right); }
 
 
+	namespace detail::rational_traits
+	{
+		// x * 2^exponent, exact as long as the result is normal
+		template <typename Float>
+		constexpr Float scale_exp2(Float x, int exponent) noexcept
+		{
+			constexpr Float step = Float(std::uint64_t{1} << 32);
+			for(; exponent >= 32; exponent -= 32)
+				x *= step;
+			for(; exponent <= -32; exponent += 32)
+				x /= step;
+			return exponent >= 0
+				? x * Float(std::uint64_t{1} << exponent)
+				: x / Float(std::uint64_t{1} << -exponent);
+		}
+
+		template <typename Int>
+		constexpr std::uint64_t magnitude(Int x) noexcept
+		{ return negative(x) ? std::uint64_t(0) - std::uint64_t(x) : std::uint64_t(x); }
+	} // namespace detail::rational_traits
+
+	// closest ratio to the value with the denominator at most max_denominator
+	// (and the numerator in range of Num), values out of range are clamped,
+	// continued fraction of the exact binary value, so only O(log(max_denominator)) steps
+	template <typename Num>
+	[[nodiscard]] constexpr rational<Num> best_rational(double value, Num max_denominator)
+	{
+		static_assert(std::is_integral_v<Num> && sizeof(Num) <= sizeof(std::uint64_t));
+		static_assert(std::numeric_limits<double>::is_iec559);
+		assert(max_denominator > 0);
+		assert(value == value && "Can't approximate NaN.");
+		using wide = wide_uint<128>;
+		using limits = std::numeric_limits<Num>;
+
+		const bool negative = value < 0;
+		if(negative)
+			value = -value;
+		if constexpr (std::is_unsigned_v<Num>)
+			if(negative)
+				return rational<Num>(Num{}, Num{1});
+		auto result = [negative](std::uint64_t numerator, std::uint64_t denominator)
+		{
+			return rational<Num>(Num(negative ? std::uint64_t(0) - numerator : numerator), Num(denominator));
+		};
+
+		const std::uint64_t max_numerator = negative
+			? detail::rational_traits::magnitude(limits::min())
+			: std::uint64_t(limits::max());
+		const std::uint64_t max_denom = std::uint64_t(max_denominator);
+		if(value >= double(max_numerator))
+			return result(max_numerator, 1);
+
+		// value = mantissa * 2^exponent
+		const auto bits = bit_cast<std::uint64_t>(value);
+		constexpr int mantissa_bits = std::numeric_limits<double>::digits - 1;
+		std::uint64_t mantissa = bits & ((std::uint64_t{1} << mantissa_bits) - 1);
+		int exponent = int(bits >> mantissa_bits);
+		if(exponent == 0)
+			exponent = 1; // subnormal
+		else
+			mantissa |= std::uint64_t{1} << mantissa_bits;
+		exponent -= std::numeric_limits<double>::max_exponent - 1 + mantissa_bits;
+		if(mantissa == 0)
+			return result(0, 1);
+		const int zeros = count_trailing_zeros(mantissa);
+		mantissa >>= zeros;
+		exponent += zeros;
+
+		if(exponent >= 0)
+			return result(mantissa << exponent, 1);
+		// less than 2^-75, closer to zero than to 1/2^64
+		if(exponent < -127)
+			return result(0, 1);
+
+		const wide denominator = wide(1) << -exponent;
+		if(denominator <= wide(max_denom) && mantissa <= max_numerator)
+			return result(mantissa, std::uint64_t(denominator));
+
+		// convergents p/q
+		std::uint64_t p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+		wide n = mantissa, d = denominator;
+		constexpr auto unlimited = ~std::uint64_t{};
+		while(true)
+		{
+			const wide term = n / d;
+			// the next convergent would be out of range
+			const std::uint64_t term_limit = std::min(
+				q1 == 0 ? unlimited : (max_denom - q0) / q1,
+				p1 == 0 ? unlimited : (max_numerator - p0) / p1);
+			if(term > wide(term_limit))
+				break;
+			const auto a = std::uint64_t(term);
+			const std::uint64_t p2 = p0 + a * p1, q2 = q0 + a * q1;
+			p0 = p1;
+			q0 = q1;
+			p1 = p2;
+			q1 = q2;
+			const wide remainder = n - term * d;
+			n = d;
+			d = remainder;
+			if(!d)
+				return result(p1, q1);
+		}
+
+		// the best one is either the last convergent, or the largest semiconvergent that fits,
+		// distance between them is 1/(q1*q), from convergent to the value is d/(q1*denominator)
+		const std::uint64_t k = std::min((max_denom - q0) / q1,
+			p1 == 0 ? unlimited : (max_numerator - p0) / p1);
+		const std::uint64_t q = q0 + k * q1;
+		if(full_product(d, wide(q)) << 1 <= wide_uint<256>(denominator))
+			return result(p1, q1);
+		return result(p0 + k * p1, q);
+	}
+
+	// correctly rounded to nearest (ties to even), unlike Float(numerator) / Float(denominator)
+	// which rounds twice if they don't fit the mantissa
+	template <typename Float, typename Num, typename Denom>
+	[[nodiscard]] constexpr Float to_float(const rational<Num, Denom>& value)
+	{
+		static_assert(std::is_floating_point_v<Float> && std::numeric_limits<Float>::radix == 2);
+		static_assert(std::is_integral_v<Num> && sizeof(Num) <= sizeof(std::uint64_t));
+		constexpr int digits = std::numeric_limits<Float>::digits;
+		static_assert(digits < 128);
+
+		const auto denominator = value.denominator();
+		assert(denominator != 0 && "Division by zero.");
+		const bool negative = detail::rational_traits::negative(value.numerator())
+			!= detail::rational_traits::negative(denominator);
+		const std::uint64_t n = detail::rational_traits::magnitude(value.numerator());
+		const std::uint64_t d = detail::rational_traits::magnitude(denominator);
+		if(n == 0)
+			return negative ? -Float(0) : Float(0);
+
+		Float result{};
+		if(bit_width(n) <= digits && bit_width(d) <= digits)
+			// both exact, so only the division rounds
+			result = Float(n) / Float(d);
+		else
+		{
+			// get a quotient with one or two bits beyond the mantissa, the rest goes into sticky bit
+			using wide = wide_uint<256>;
+			const int shift = digits + 1 - (bit_width(n) - bit_width(d));
+			const wide dividend = shift > 0 ? wide(n) << shift : wide(n);
+			const wide divisor = shift < 0 ? wide(d) << -shift : wide(d);
+			wide quotient, remainder;
+			wide::divide(dividend, divisor, quotient, remainder);
+			const int extra = bit_width(quotient) - digits;
+			const auto lower = std::uint64_t(quotient >> extra);
+			const auto dropped = std::uint64_t(quotient) & ((std::uint64_t{1} << extra) - 1);
+			const std::uint64_t half = std::uint64_t{1} << (extra - 1);
+			const bool up = dropped > half || (dropped == half && (remainder || (lower & 1)));
+			// lower + 1 may not fit, but is a power of two
+			result = detail::rational_traits::scale_exp2(Float(lower) + Float(up), extra - shift);
+		}
+		return negative ? -result : result;
+	}
+
+	// interpolation by an exact ratio, the batched versions are in algorithm/numeric.hpp
+	template <typename Number, typename Num, typename Denom,
+		std::enable_if_t<not is_range_v<Number>>* = nullptr>
+	[[nodiscard]] constexpr
+	Number way(Number from, Number to, const rational<Num, Denom>& ratio)
+	{
+		if constexpr (std::is_floating_point_v<Number>)
+			return from + (to - from) * Number(ratio.numerator()) / Number(ratio.denominator());
+		else if constexpr (std::is_integral_v<Number> && std::is_integral_v<Num>)
+		{
+			// the difference must not be narrowed to the ratio's type, and the product must not overflow
+			using int_t = std::common_type_t<Number, Num>;
+			return from + Number(muldiv(int_t(to - from), int_t(ratio.numerator()), int_t(ratio.denominator())));
+		}
+		else
+			return from + Number(Num(to - from) * ratio.numerator() / ratio.denominator());
+	}
+
+	template <typename Number, typename Num, typename Denom,
+		std::enable_if_t<not is_range_v<Number>>* = nullptr>
+	[[nodiscard]] constexpr
+	Number wayback(Number from, Number to, const rational<Num, Denom>& ratio)
+	{
+		if constexpr (std::is_floating_point_v<Number>)
+			return from - (from - to) * Number(ratio.numerator()) / Number(ratio.denominator());
+		else if constexpr (std::is_integral_v<Number> && std::is_integral_v<Num>)
+		{
+			using int_t = std::common_type_t<Number, Num>;
+			return from - Number(muldiv(int_t(from - to), int_t(ratio.numerator()), int_t(ratio.denominator())));
+		}
+		else
+			return from - Number(Num(from - to) * ratio.numerator() / ratio.denominator());
+	}
+
 } // namespace simple::support
 
+namespace simple::support::literals
+{
+
+	namespace details
+	{
+
+		template <char... chars>
+		constexpr rational<std::intmax_t> parse_rational() noexcept
+		{
+			constexpr char literal[] = {chars...};
+			constexpr decimal value = parse_decimal(literal, sizeof...(chars));
+			static_assert( value.valid, "Invalid rational literal, only decimal digits with a point are supported" );
+			static_assert( not value.overflow && value.mantissa <= std::uintmax_t(std::numeric_limits<std::intmax_t>::max()),
+				"Rational literal out of range" );
+			static_assert( value.scale <= std::numeric_limits<std::intmax_t>::digits10,
+				"Rational literal has too many digits after the point" );
+			constexpr auto denominator = []()
+			{
+				std::intmax_t result = 1;
+				for(int i = 0; i != value.scale; ++i)
+					result *= 10;
+				return result;
+			}();
+			constexpr auto common = gcd(std::intmax_t(value.mantissa), denominator);
+			return {std::intmax_t(value.mantissa) / common, denominator / common};
+		}
+
+	} // namespace details
+
+	// exact decimal value, in lowest terms
+	template<char... chars>
+	constexpr rational<std::intmax_t> operator"" _r()
+	{
+		return details::parse_rational<chars...>();
+	}
+
+} // namespace simple::support::literals
+
 #endif /* end of include guard */
@@ -0,0 +1,1128 @@
+#ifndef SIMPLE_SUPPORT_ROARING_HPP
+#define SIMPLE_SUPPORT_ROARING_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "bits.hpp"
+#include "algorithm/set_ops.hpp"
+
+namespace simple::support
+{
+
+	class roaring_bitmap;
+	class roaring_view;
+
+	// the set of 32 bit values is split into chunks by the high 16 bits,
+	// and the low 16 bits of each chunk are stored in one of three kinds of containers:
+	// sorted array for sparse chunks, plain bitmap for dense ones,
+	// and sorted list of ranges for chunks that have long runs
+	namespace detail::roaring
+	{
+
+		enum class kind : std::uint16_t
+		{
+			array,
+			bitmap,
+			run
+		};
+
+		constexpr std::size_t chunk_bits = 16;
+		constexpr std::size_t bitmap_words = (std::size_t{1} << chunk_bits) / 64;
+		// array of this many values is as big as the bitmap
+		constexpr std::size_t max_array = bitmap_words * 64 / 16;
+
+		using words = std::array<std::uint64_t, bitmap_words>;
+
+		// inclusive range
+		struct run
+		{
+			std::uint16_t first;
+			std::uint16_t last;
+		};
+		static_assert(sizeof(run) == 2 * sizeof(std::uint16_t));
+
+		constexpr std::size_t element_size(kind type) noexcept
+		{
+			switch(type)
+			{
+				case kind::array: return sizeof(std::uint16_t);
+				case kind::bitmap: return sizeof(std::uint64_t);
+				case kind::run: return sizeof(run);
+			}
+			return 0;
+		}
+
+		// a serialized buffer has no objects of the element types in it,
+		// and might not be aligned for them, memcpy is the only legal way to read it,
+		// and compilers turn it into plain loads
+		template <typename T>
+		T load(const std::byte* data, std::size_t index = 0) noexcept
+		{
+			T value;
+			std::memcpy(&value, data + index * sizeof(T), sizeof(T));
+			return value;
+		}
+
+		template <typename T>
+		std::byte* store(std::byte* data, const T& value) noexcept
+		{
+			std::memcpy(data, &value, sizeof(T));
+			return data + sizeof(T);
+		}
+
+		template <typename T>
+		class load_iterator
+		{
+			public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const T*;
+			using reference = T;
+
+			load_iterator() = default;
+			explicit load_iterator(const std::byte* data) noexcept : data(data) {}
+
+			T operator*() const noexcept { return load<T>(data); }
+
+			load_iterator& operator++() noexcept
+			{
+				data += sizeof(T);
+				return *this;
+			}
+
+			load_iterator operator++(int) noexcept
+			{
+				auto previous = *this;
+				++(*this);
+				return previous;
+			}
+
+			bool operator==(const load_iterator& other) const noexcept { return data == other.data; }
+			bool operator!=(const load_iterator& other) const noexcept { return data != other.data; }
+
+			private:
+			const std::byte* data = nullptr;
+		};
+
+		// non owning, works the same for containers in memory and in a serialized buffer
+		struct container_view
+		{
+			kind type;
+			std::uint32_t cardinality;
+			std::uint32_t size; // number of values, words or runs
+			const std::byte* data;
+
+			template <typename T>
+			T at(std::size_t index) const noexcept { return load<T>(data, index); }
+
+			template <typename T>
+			load_iterator<T> begin() const noexcept { return load_iterator<T>(data); }
+
+			template <typename T>
+			load_iterator<T> end() const noexcept { return load_iterator<T>(data + size * sizeof(T)); }
+		};
+
+		inline bool contains(const container_view& c, std::uint16_t value) noexcept
+		{
+			switch(c.type)
+			{
+				case kind::array:
+				{
+					std::size_t low = 0, high = c.size;
+					while(low < high)
+					{
+						const std::size_t middle = low + (high - low) / 2;
+						if(c.at<std::uint16_t>(middle) < value)
+							low = middle + 1;
+						else
+							high = middle;
+					}
+					return low < c.size && c.at<std::uint16_t>(low) == value;
+				}
+
+				case kind::bitmap:
+					return (c.at<std::uint64_t>(value / 64) >> (value % 64)) & 1;
+
+				case kind::run:
+				{
+					// find the last run that starts no later than the value
+					std::size_t low = 0, high = c.size;
+					while(low < high)
+					{
+						const std::size_t middle = low + (high - low) / 2;
+						if(c.at<run>(middle).first <= value)
+							low = middle + 1;
+						else
+							high = middle;
+					}
+					return low != 0 && value <= c.at<run>(low - 1).last;
+				}
+			}
+			return false;
+		}
+
+		template <typename Function>
+		void for_each(const container_view& c, Function&& f)
+		{
+			switch(c.type)
+			{
+				case kind::array:
+					for(auto i = c.begin<std::uint16_t>(); i != c.end<std::uint16_t>(); ++i)
+						f(*i);
+				break;
+
+				case kind::bitmap:
+					for(auto bit : set_bits(c.begin<std::uint64_t>(), c.end<std::uint64_t>()))
+						f(std::uint16_t(bit));
+				break;
+
+				case kind::run:
+					for(auto i = c.begin<run>(); i != c.end<run>(); ++i)
+					{
+						const run r = *i;
+						for(std::uint32_t value = r.first; value <= r.last; ++value)
+							f(std::uint16_t(value));
+					}
+				break;
+			}
+		}
+
+		inline void fill_bits(words& bits, std::uint32_t first, std::uint32_t last, bool value) noexcept
+		{
+			const std::size_t first_word = first / 64;
+			const std::size_t last_word = last / 64;
+			const std::uint64_t first_mask = ~std::uint64_t{} << (first % 64);
+			const std::uint64_t last_mask = ~std::uint64_t{} >> (63 - last % 64);
+			auto apply = [&bits, value](std::size_t index, std::uint64_t mask)
+			{
+				if(value)
+					bits[index] |= mask;
+				else
+					bits[index] &= ~mask;
+			};
+			if(first_word == last_word)
+				return apply(first_word, first_mask & last_mask);
+			apply(first_word, first_mask);
+			for(std::size_t i = first_word + 1; i < last_word; ++i)
+				apply(i, ~std::uint64_t{});
+			apply(last_word, last_mask);
+		}
+
+		// sets or clears the bits of the container's values
+		inline void fill_bits(words& bits, const container_view& c, bool value) noexcept
+		{
+			switch(c.type)
+			{
+				case kind::array:
+					for(auto i = c.begin<std::uint16_t>(); i != c.end<std::uint16_t>(); ++i)
+						fill_bits(bits, *i, *i, value);
+				break;
+
+				case kind::bitmap:
+					for(std::size_t i = 0; i < bitmap_words; ++i)
+					{
+						if(value)
+							bits[i] |= c.at<std::uint64_t>(i);
+						else
+							bits[i] &= ~c.at<std::uint64_t>(i);
+					}
+				break;
+
+				case kind::run:
+					for(auto i = c.begin<run>(); i != c.end<run>(); ++i)
+						fill_bits(bits, (*i).first, (*i).last, value);
+				break;
+			}
+		}
+
+		struct container
+		{
+			kind type = kind::array;
+			std::uint32_t cardinality = 0;
+			std::vector<std::uint16_t> values;
+			std::vector<std::uint64_t> bits;
+			std::vector<run> runs;
+
+			container_view view() const noexcept
+			{
+				switch(type)
+				{
+					case kind::array:
+						return {type, cardinality, std::uint32_t(values.size()),
+							reinterpret_cast<const std::byte*>(values.data())};
+					case kind::bitmap:
+						return {type, cardinality, std::uint32_t(bits.size()),
+							reinterpret_cast<const std::byte*>(bits.data())};
+					case kind::run:
+						return {type, cardinality, std::uint32_t(runs.size()),
+							reinterpret_cast<const std::byte*>(runs.data())};
+				}
+				return {};
+			}
+
+			std::size_t byte_size() const noexcept
+			{
+				return view().size * element_size(type);
+			}
+		};
+
+		inline container from_words(const words& bits)
+		{
+			container result;
+			result.cardinality = std::uint32_t(count_ones(bits));
+			if(result.cardinality <= max_array)
+			{
+				result.type = kind::array;
+				result.values.reserve(result.cardinality);
+				for(auto bit : set_bits(bits))
+					result.values.push_back(std::uint16_t(bit));
+			}
+			else
+			{
+				result.type = kind::bitmap;
+				result.bits.assign(bits.begin(), bits.end());
+			}
+			return result;
+		}
+
+		inline container from_values(std::vector<std::uint16_t> values)
+		{
+			if(values.size() > max_array)
+			{
+				words bits{};
+				for(auto value : values)
+					fill_bits(bits, value, value, true);
+				return from_words(bits);
+			}
+			container result;
+			result.type = kind::array;
+			result.cardinality = std::uint32_t(values.size());
+			result.values = std::move(values);
+			return result;
+		}
+
+		// runs only pay off if there are few of them, otherwise pick the smallest of the other two
+		inline container from_runs(std::vector<run> runs)
+		{
+			std::uint32_t cardinality = 0;
+			for(auto r : runs)
+				cardinality += std::uint32_t(r.last) - r.first + 1;
+
+			const std::size_t run_size = runs.size() * sizeof(run);
+			const std::size_t other_size = cardinality <= max_array
+				? cardinality * sizeof(std::uint16_t)
+				: bitmap_words * sizeof(std::uint64_t);
+			if(run_size < other_size)
+			{
+				container result;
+				result.type = kind::run;
+				result.cardinality = cardinality;
+				result.runs = std::move(runs);
+				return result;
+			}
+
+			words bits{};
+			for(auto r : runs)
+				fill_bits(bits, r.first, r.last, true);
+			return from_words(bits);
+		}
+
+		// the first run that starts after the value
+		inline std::vector<run>::iterator find_run(std::vector<run>& runs, std::uint16_t value) noexcept
+		{
+			return std::upper_bound(runs.begin(), runs.end(), value,
+				[](std::uint16_t x, const run& r) { return x < r.first; });
+		}
+
+		inline container copy(const container_view& c)
+		{
+			container result;
+			result.type = c.type;
+			result.cardinality = c.cardinality;
+			switch(c.type)
+			{
+				case kind::array:
+					result.values.assign(c.begin<std::uint16_t>(), c.end<std::uint16_t>());
+				break;
+				case kind::bitmap:
+					result.bits.assign(c.begin<std::uint64_t>(), c.end<std::uint64_t>());
+				break;
+				case kind::run:
+					result.runs.assign(c.begin<run>(), c.end<run>());
+				break;
+			}
+			return result;
+		}
+
+		inline std::vector<run> to_runs(const container_view& c)
+		{
+			std::vector<run> runs;
+			for_each(c, [&runs](std::uint16_t value)
+			{
+				if(!runs.empty() && std::uint32_t(runs.back().last) + 1 == value)
+					runs.back().last = value;
+				else
+					runs.push_back({value, value});
+			});
+			return runs;
+		}
+
+		inline std::vector<run> unite_runs(const container_view& a, const container_view& b)
+		{
+			std::vector<run> result;
+			std::size_t i = 0, j = 0;
+			while(i < a.size || j < b.size)
+			{
+				run next;
+				if(j == b.size || (i < a.size && a.at<run>(i).first < b.at<run>(j).first))
+					next = a.at<run>(i++);
+				else
+					next = b.at<run>(j++);
+
+				if(!result.empty() && next.first <= std::uint32_t(result.back().last) + 1)
+					result.back().last = std::max(result.back().last, next.last);
+				else
+					result.push_back(next);
+			}
+			return result;
+		}
+
+		inline std::vector<run> intersect_runs(const container_view& a, const container_view& b)
+		{
+			std::vector<run> result;
+			std::size_t i = 0, j = 0;
+			while(i < a.size && j < b.size)
+			{
+				const run x = a.at<run>(i);
+				const run y = b.at<run>(j);
+				const auto first = std::max(x.first, y.first);
+				const auto last = std::min(x.last, y.last);
+				if(first <= last)
+					result.push_back({first, last});
+				if(x.last < y.last)
+					++i;
+				else
+					++j;
+			}
+			return result;
+		}
+
+		inline std::vector<run> subtract_runs(const container_view& a, const container_view& b)
+		{
+			std::vector<run> result;
+			std::size_t j = 0;
+			for(std::size_t i = 0; i < a.size; ++i)
+			{
+				const run x = a.at<run>(i);
+				std::uint32_t first = x.first;
+				while(j < b.size && b.at<run>(j).last < first)
+					++j;
+				for(; j < b.size && b.at<run>(j).first <= x.last; ++j)
+				{
+					const run y = b.at<run>(j);
+					if(y.first > first)
+						result.push_back({std::uint16_t(first), std::uint16_t(y.first - 1)});
+					first = std::uint32_t(y.last) + 1;
+					// might cut into the next one as well
+					if(y.last > x.last)
+						break;
+				}
+				if(first <= x.last)
+					result.push_back({std::uint16_t(first), x.last});
+			}
+			return result;
+		}
+
+		inline container unite(const container_view& a, const container_view& b)
+		{
+			if(a.type == kind::array && b.type == kind::array)
+			{
+				std::vector<std::uint16_t> values;
+				values.reserve(a.size + b.size);
+				std::set_union(a.begin<std::uint16_t>(), a.end<std::uint16_t>(),
+					b.begin<std::uint16_t>(), b.end<std::uint16_t>(),
+					std::back_inserter(values));
+				return from_values(std::move(values));
+			}
+
+			if(a.type == kind::run && b.type == kind::run)
+				return from_runs(unite_runs(a, b));
+
+			words bits{};
+			fill_bits(bits, a, true);
+			fill_bits(bits, b, true);
+			return from_words(bits);
+		}
+
+		inline container intersect(const container_view& a, const container_view& b)
+		{
+			if(a.type == kind::array && b.type == kind::array)
+			{
+				std::vector<std::uint16_t> values;
+				values.reserve(std::min(a.size, b.size));
+				std::set_intersection(a.begin<std::uint16_t>(), a.end<std::uint16_t>(),
+					b.begin<std::uint16_t>(), b.end<std::uint16_t>(),
+					std::back_inserter(values));
+				return from_values(std::move(values));
+			}
+
+			// the result is at most as big as the array, so just look up each value
+			if(a.type == kind::array || b.type == kind::array)
+			{
+				const auto& array = a.type == kind::array ? a : b;
+				const auto& other = a.type == kind::array ? b : a;
+				std::vector<std::uint16_t> values;
+				values.reserve(array.size);
+				for(auto i = array.begin<std::uint16_t>(); i != array.end<std::uint16_t>(); ++i)
+					if(contains(other, *i))
+						values.push_back(*i);
+				return from_values(std::move(values));
+			}
+
+			if(a.type == kind::run && b.type == kind::run)
+				return from_runs(intersect_runs(a, b));
+
+			words bits{};
+			fill_bits(bits, a, true);
+			if(b.type == kind::bitmap)
+				for(std::size_t i = 0; i < bitmap_words; ++i)
+					bits[i] &= b.at<std::uint64_t>(i);
+			else
+			{
+				words other{};
+				fill_bits(other, b, true);
+				for(std::size_t i = 0; i < bitmap_words; ++i)
+					bits[i] &= other[i];
+			}
+			return from_words(bits);
+		}
+
+		inline container subtract(const container_view& a, const container_view& b)
+		{
+			if(a.type == kind::array && b.type == kind::array)
+			{
+				std::vector<std::uint16_t> values;
+				values.reserve(a.size);
+				support::set_difference(a.begin<std::uint16_t>(), a.end<std::uint16_t>(),
+					b.begin<std::uint16_t>(), b.end<std::uint16_t>(),
+					std::back_inserter(values));
+				return from_values(std::move(values));
+			}
+
+			if(a.type == kind::array)
+			{
+				std::vector<std::uint16_t> values;
+				values.reserve(a.size);
+				for(auto i = a.begin<std::uint16_t>(); i != a.end<std::uint16_t>(); ++i)
+					if(!contains(b, *i))
+						values.push_back(*i);
+				return from_values(std::move(values));
+			}
+
+			if(a.type == kind::run && b.type == kind::run)
+				return from_runs(subtract_runs(a, b));
+
+			words bits{};
+			fill_bits(bits, a, true);
+			fill_bits(bits, b, false);
+			return from_words(bits);
+		}
+
+		// serialized layout, native byte order:
+		// header: chunk count, reserved (u32, u32)
+		// chunk descriptors: key, kind (u16, u16), cardinality, size, data offset (u32, u32, u32), padding (u32)
+		// container data, each aligned to 8 bytes
+		constexpr std::size_t header_size = 2 * sizeof(std::uint32_t);
+		constexpr std::size_t descriptor_size = 2 * sizeof(std::uint16_t) + 4 * sizeof(std::uint32_t);
+		constexpr std::size_t data_alignment = alignof(std::uint64_t);
+
+		constexpr std::size_t align(std::size_t offset) noexcept
+		{
+			return (offset + data_alignment - 1) / data_alignment * data_alignment;
+		}
+
+		// checks everything a view reads without looking, that is the header and descriptors,
+		// and that each container's data is in bounds and of the size its kind requires,
+		// the values themselves are not checked, wrong ones only give wrong answers
+		inline bool valid(const std::byte* buffer, std::size_t buffer_size) noexcept
+		{
+			if(buffer_size < header_size)
+				return false;
+			const std::size_t count = load<std::uint32_t>(buffer);
+			if(count > (buffer_size - header_size) / descriptor_size)
+				return false;
+			const std::size_t data_begin = header_size + count * descriptor_size;
+
+			std::uint32_t previous_key = 0;
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				const std::byte* d = buffer + header_size + i * descriptor_size;
+				const auto key = load<std::uint16_t>(d);
+				d += sizeof(std::uint16_t);
+				const auto type = load<std::uint16_t>(d);
+				d += sizeof(std::uint16_t);
+				const auto cardinality = load<std::uint32_t>(d);
+				d += sizeof(std::uint32_t);
+				const auto size = load<std::uint32_t>(d);
+				d += sizeof(std::uint32_t);
+				const std::size_t offset = load<std::uint32_t>(d);
+
+				// keys must be strictly increasing for the binary search
+				if(i != 0 && key <= previous_key)
+					return false;
+				previous_key = key;
+
+				if(cardinality == 0 || cardinality > std::uint32_t{1} << chunk_bits)
+					return false;
+				switch(kind(type))
+				{
+					case kind::array:
+						if(size != cardinality || size > max_array)
+							return false;
+					break;
+					case kind::bitmap:
+						if(size != bitmap_words)
+							return false;
+					break;
+					case kind::run:
+						if(size == 0 || size > cardinality)
+							return false;
+					break;
+					default:
+						return false;
+				}
+
+				if(offset < data_begin || offset > buffer_size ||
+					size > (buffer_size - offset) / element_size(kind(type)))
+					return false;
+			}
+			return true;
+		}
+
+		template <typename T, typename = std::nullptr_t>
+		struct is_roaring : std::false_type {};
+		template <typename T>
+		struct is_roaring<T, decltype(
+			std::declval<const T&>().chunk_count(),
+			std::declval<const T&>().chunk_key(0),
+			std::declval<const T&>().chunk(0),
+			nullptr)>
+		: std::true_type {};
+		template <typename T>
+		constexpr bool is_roaring_v = is_roaring<T>::value;
+
+		// binary search for the chunk, returns chunk count if not found
+		template <typename Roaring>
+		std::size_t find_chunk(const Roaring& r, std::uint16_t key) noexcept
+		{
+			std::size_t low = 0, high = r.chunk_count();
+			while(low < high)
+			{
+				const std::size_t middle = low + (high - low) / 2;
+				if(r.chunk_key(middle) < key)
+					low = middle + 1;
+				else
+					high = middle;
+			}
+			return low < r.chunk_count() && r.chunk_key(low) == key ? low : r.chunk_count();
+		}
+
+		template <typename Roaring>
+		bool contains(const Roaring& r, std::uint32_t value) noexcept
+		{
+			const std::size_t chunk = find_chunk(r, std::uint16_t(value >> chunk_bits));
+			return chunk != r.chunk_count() && contains(r.chunk(chunk), std::uint16_t(value));
+		}
+
+		template <typename Roaring>
+		std::size_t size(const Roaring& r) noexcept
+		{
+			std::size_t result = 0;
+			for(std::size_t i = 0; i < r.chunk_count(); ++i)
+				result += r.chunk(i).cardinality;
+			return result;
+		}
+
+		template <typename Roaring, typename Function>
+		void for_each(const Roaring& r, Function&& f)
+		{
+			for(std::size_t i = 0; i < r.chunk_count(); ++i)
+			{
+				const std::uint32_t high = std::uint32_t(r.chunk_key(i)) << chunk_bits;
+				for_each(r.chunk(i), [&f, high](std::uint16_t low) { f(high | low); });
+			}
+		}
+
+		template <typename Roaring, typename OtherRoaring>
+		bool equal(const Roaring& a, const OtherRoaring& b)
+		{
+			if(a.chunk_count() != b.chunk_count())
+				return false;
+			for(std::size_t i = 0; i < a.chunk_count(); ++i)
+			{
+				if(a.chunk_key(i) != b.chunk_key(i))
+					return false;
+				const auto x = a.chunk(i);
+				const auto y = b.chunk(i);
+				if(x.cardinality != y.cardinality)
+					return false;
+				if(x.type == y.type)
+				{
+					if(x.size != y.size || std::memcmp(x.data, y.data, x.size * element_size(x.type)) != 0)
+						return false;
+				}
+				else
+				{
+					words x_bits{};
+					words y_bits{};
+					fill_bits(x_bits, x, true);
+					fill_bits(y_bits, y, true);
+					if(x_bits != y_bits)
+						return false;
+				}
+			}
+			return true;
+		}
+
+		struct access
+		{
+			template <typename A, typename B, typename Operation>
+			static roaring_bitmap combine(const A& a, const B& b, Operation operation,
+				bool keep_a, bool keep_b);
+
+			template <typename Roaring>
+			static roaring_bitmap copy(const Roaring& r);
+		};
+
+	} // namespace detail::roaring
+
+// set operations for any combination of bitmaps and views, defined as hidden friends,
+// found only through the argument types, Condition decides which class gets which combination
+#define SIMPLE_SUPPORT_ROARING_OPERATOR(op_sym, operation, keep_a, keep_b) \
+template <typename A, typename B, std::enable_if_t<Condition<A, B>>* = nullptr> \
+[[nodiscard]] friend roaring_bitmap operator op_sym (const A& a, const B& b) \
+{ return detail::roaring::access::combine(a, b, detail::roaring::operation, keep_a, keep_b); }
+
+#define SIMPLE_SUPPORT_ROARING_OPERATORS \
+SIMPLE_SUPPORT_ROARING_OPERATOR(|, unite, true, true) \
+SIMPLE_SUPPORT_ROARING_OPERATOR(&, intersect, false, false) \
+SIMPLE_SUPPORT_ROARING_OPERATOR(-, subtract, true, false) \
+template <typename A, typename B, std::enable_if_t<Condition<A, B>>* = nullptr> \
+[[nodiscard]] friend bool operator==(const A& a, const B& b) \
+{ return detail::roaring::equal(a, b); } \
+template <typename A, typename B, std::enable_if_t<Condition<A, B>>* = nullptr> \
+[[nodiscard]] friend bool operator!=(const A& a, const B& b) \
+{ return !detail::roaring::equal(a, b); }
+
+	// compressed set of 32 bit values
+	class roaring_bitmap
+	{
+		public:
+		using value_type = std::uint32_t;
+
+		roaring_bitmap() = default;
+
+		template <typename It>
+		roaring_bitmap(It begin, It end)
+		{
+			for(; begin != end; ++begin)
+				add(*begin);
+		}
+
+		roaring_bitmap(std::initializer_list<value_type> values) :
+			roaring_bitmap(values.begin(), values.end())
+		{}
+
+		// returns whether the value was added
+		bool add(value_type value)
+		{
+			using namespace detail::roaring;
+			const auto key = std::uint16_t(value >> chunk_bits);
+			const auto low = std::uint16_t(value);
+			const auto position = std::lower_bound(keys.begin(), keys.end(), key);
+			const auto index = position - keys.begin();
+			if(position == keys.end() || *position != key)
+			{
+				keys.insert(position, key);
+				containers.insert(containers.begin() + index, container{kind::array, 1, {low}, {}, {}});
+				return true;
+			}
+
+			auto& c = containers[index];
+			if(c.type == kind::run)
+			{
+				// extends or joins the neighbouring runs, or starts a new one,
+				// whether it's still worth being runs is left to optimize()
+				const auto next = find_run(c.runs, low);
+				const auto previous = next != c.runs.begin() ? std::prev(next) : c.runs.end();
+				if(previous != c.runs.end() && low <= previous->last)
+					return false;
+				const bool joins_previous = previous != c.runs.end() &&
+					std::uint32_t(previous->last) + 1 == low;
+				const bool joins_next = next != c.runs.end() &&
+					std::uint32_t(low) + 1 == next->first;
+				if(joins_previous && joins_next)
+				{
+					previous->last = next->last;
+					c.runs.erase(next);
+				}
+				else if(joins_previous)
+					previous->last = low;
+				else if(joins_next)
+					next->first = low;
+				else
+					c.runs.insert(next, {low, low});
+				++c.cardinality;
+				return true;
+			}
+
+			if(c.type == kind::array)
+			{
+				const auto found = std::lower_bound(c.values.begin(), c.values.end(), low);
+				if(found != c.values.end() && *found == low)
+					return false;
+				if(c.values.size() < max_array)
+				{
+					c.values.insert(found, low);
+					++c.cardinality;
+					return true;
+				}
+				c.type = kind::bitmap;
+				c.bits.assign(bitmap_words, 0);
+				for(auto v : c.values)
+					c.bits[v / 64] |= std::uint64_t{1} << (v % 64);
+				c.values.clear();
+				c.values.shrink_to_fit();
+			}
+
+			auto& word = c.bits[low / 64];
+			const auto bit = std::uint64_t{1} << (low % 64);
+			if(word & bit)
+				return false;
+			word |= bit;
+			++c.cardinality;
+			return true;
+		}
+
+		// returns whether the value was removed
+		bool remove(value_type value)
+		{
+			using namespace detail::roaring;
+			const std::size_t index = find_chunk(*this, std::uint16_t(value >> chunk_bits));
+			const auto low = std::uint16_t(value);
+			if(index == keys.size() || !detail::roaring::contains(containers[index].view(), low))
+				return false;
+
+			auto& c = containers[index];
+			switch(c.type)
+			{
+				case kind::array:
+					c.values.erase(std::lower_bound(c.values.begin(), c.values.end(), low));
+				break;
+
+				case kind::bitmap:
+					c.bits[low / 64] &= ~(std::uint64_t{1} << (low % 64));
+					// back to an array once it's as small as one, same as from_words
+					if(c.cardinality - 1 == max_array)
+					{
+						c.values.reserve(max_array);
+						for(auto bit : set_bits(c.bits.begin(), c.bits.end()))
+							c.values.push_back(std::uint16_t(bit));
+						c.bits.clear();
+						c.bits.shrink_to_fit();
+						c.type = kind::array;
+					}
+				break;
+
+				case kind::run:
+				{
+					// shrinks or splits the run, whether it's still worth being runs is left to optimize()
+					const auto containing = std::prev(find_run(c.runs, low));
+					if(containing->first == containing->last)
+						c.runs.erase(containing);
+					else if(low == containing->first)
+						++containing->first;
+					else if(low == containing->last)
+						--containing->last;
+					else
+					{
+						const run rest{std::uint16_t(low + 1), containing->last};
+						containing->last = std::uint16_t(low - 1);
+						c.runs.insert(std::next(containing), rest);
+					}
+				}
+				break;
+			}
+			--c.cardinality;
+
+			if(c.cardinality == 0)
+			{
+				keys.erase(keys.begin() + index);
+				containers.erase(containers.begin() + index);
+			}
+			return true;
+		}
+
+		[[nodiscard]] bool contains(value_type value) const noexcept
+		{ return detail::roaring::contains(*this, value); }
+
+		[[nodiscard]] std::size_t size() const noexcept
+		{ return detail::roaring::size(*this); }
+
+		[[nodiscard]] bool empty() const noexcept
+		{ return keys.empty(); }
+
+		template <typename Function>
+		void for_each(Function&& f) const
+		{ detail::roaring::for_each(*this, std::forward<Function>(f)); }
+
+		// converts containers to runs where that takes less space
+		void optimize()
+		{
+			for(auto& c : containers)
+				if(c.type != detail::roaring::kind::run)
+					c = detail::roaring::from_runs(detail::roaring::to_runs(c.view()));
+		}
+
+		// low level access to containers, shared with roaring_view
+		[[nodiscard]] std::size_t chunk_count() const noexcept { return keys.size(); }
+		[[nodiscard]] std::uint16_t chunk_key(std::size_t index) const noexcept { return keys[index]; }
+		[[nodiscard]] detail::roaring::container_view chunk(std::size_t index) const noexcept
+		{ return containers[index].view(); }
+
+		[[nodiscard]] std::size_t serialized_size() const noexcept
+		{
+			using namespace detail::roaring;
+			std::size_t size = header_size + descriptor_size * keys.size();
+			for(auto& c : containers)
+				size = align(size) + c.byte_size();
+			return size;
+		}
+
+		// writes serialized_size() bytes, returns the end
+		std::byte* serialize(std::byte* out) const noexcept
+		{
+			using namespace detail::roaring;
+			std::byte* const begin = out;
+			out = store(out, std::uint32_t(keys.size()));
+			out = store(out, std::uint32_t{0});
+			std::size_t offset = header_size + descriptor_size * keys.size();
+			for(std::size_t i = 0; i < keys.size(); ++i)
+			{
+				const auto view = containers[i].view();
+				offset = align(offset);
+				out = store(out, keys[i]);
+				out = store(out, view.type);
+				out = store(out, view.cardinality);
+				out = store(out, view.size);
+				out = store(out, std::uint32_t(offset));
+				out = store(out, std::uint32_t{0});
+				offset += containers[i].byte_size();
+			}
+			for(auto& c : containers)
+			{
+				const std::size_t padding = align(out - begin) - (out - begin);
+				std::fill(out, out + padding, std::byte{0});
+				out += padding;
+				const std::size_t size = c.byte_size();
+				if(size != 0)
+					std::memcpy(out, c.view().data, size);
+				out += size;
+			}
+			return out;
+		}
+
+		template <typename Other>
+		roaring_bitmap& operator|=(const Other& other);
+		template <typename Other>
+		roaring_bitmap& operator&=(const Other& other);
+		template <typename Other>
+		roaring_bitmap& operator-=(const Other& other);
+
+		private:
+		std::vector<std::uint16_t> keys;
+		std::vector<detail::roaring::container> containers;
+
+		friend struct detail::roaring::access;
+
+		// at least one of them is a bitmap
+		template <typename A, typename B>
+		static constexpr bool Condition =
+			detail::roaring::is_roaring_v<A> && detail::roaring::is_roaring_v<B> &&
+			(std::is_same_v<A, roaring_bitmap> || std::is_same_v<B, roaring_bitmap>);
+
+		public:
+		SIMPLE_SUPPORT_ROARING_OPERATORS
+	};
+
+	// zero copy read only access to a serialized roaring_bitmap,
+	// the buffer must outlive the view
+	class roaring_view
+	{
+		public:
+		using value_type = std::uint32_t;
+
+		// the buffer must be the output of roaring_bitmap::serialize,
+		// use from() for anything that might not be
+		roaring_view(const std::byte* buffer, [[maybe_unused]] std::size_t size) noexcept :
+			buffer(buffer),
+			count(detail::roaring::load<std::uint32_t>(buffer))
+		{
+			assert(detail::roaring::valid(buffer, size) && "Invalid serialized roaring bitmap.");
+		}
+
+		// checks the layout once, so that none of the reads can go out of bounds after that,
+		// empty if the buffer is too short or corrupted
+		[[nodiscard]] static std::optional<roaring_view> from(const std::byte* buffer, std::size_t size) noexcept
+		{
+			if(!detail::roaring::valid(buffer, size))
+				return std::nullopt;
+			return roaring_view(buffer, size);
+		}
+
+		[[nodiscard]] bool contains(value_type value) const noexcept
+		{ return detail::roaring::contains(*this, value); }
+
+		[[nodiscard]] std::size_t size() const noexcept
+		{ return detail::roaring::size(*this); }
+
+		[[nodiscard]] bool empty() const noexcept
+		{ return count == 0; }
+
+		template <typename Function>
+		void for_each(Function&& f) const
+		{ detail::roaring::for_each(*this, std::forward<Function>(f)); }
+
+		[[nodiscard]] roaring_bitmap to_bitmap() const
+		{ return detail::roaring::access::copy(*this); }
+
+		[[nodiscard]] std::size_t chunk_count() const noexcept { return count; }
+
+		[[nodiscard]] std::uint16_t chunk_key(std::size_t index) const noexcept
+		{ return detail::roaring::load<std::uint16_t>(descriptor(index)); }
+
+		// the descriptors were checked on construction
+		[[nodiscard]] detail::roaring::container_view chunk(std::size_t index) const noexcept
+		{
+			using namespace detail::roaring;
+			const std::byte* d = descriptor(index) + sizeof(std::uint16_t);
+			const auto type = load<kind>(d);
+			d += sizeof(kind);
+			const auto cardinality = load<std::uint32_t>(d);
+			d += sizeof(std::uint32_t);
+			const auto size = load<std::uint32_t>(d);
+			d += sizeof(std::uint32_t);
+			const auto offset = load<std::uint32_t>(d);
+			return {type, cardinality, size, buffer + offset};
+		}
+
+		private:
+		const std::byte* buffer;
+		std::size_t count;
+
+		const std::byte* descriptor(std::size_t index) const noexcept
+		{
+			assert(index < count);
+			using namespace detail::roaring;
+			return buffer + header_size + index * descriptor_size;
+		}
+
+		// both are views, the rest is covered by roaring_bitmap
+		template <typename A, typename B>
+		static constexpr bool Condition =
+			std::is_same_v<A, roaring_view> && std::is_same_v<B, roaring_view>;
+
+		public:
+		SIMPLE_SUPPORT_ROARING_OPERATORS
+	};
+
+#undef SIMPLE_SUPPORT_ROARING_OPERATORS
+#undef SIMPLE_SUPPORT_ROARING_OPERATOR
+
+	namespace detail::roaring
+	{
+
+		// goes through both in key order, applying the operation to common chunks
+		template <typename A, typename B, typename Operation>
+		roaring_bitmap access::combine(const A& a, const B& b, Operation operation,
+			bool keep_a, bool keep_b)
+		{
+			roaring_bitmap result;
+			std::size_t i = 0, j = 0;
+			while(i < a.chunk_count() || j < b.chunk_count())
+			{
+				if(j == b.chunk_count() || (i < a.chunk_count() && a.chunk_key(i) < b.chunk_key(j)))
+				{
+					if(keep_a)
+					{
+						result.keys.push_back(a.chunk_key(i));
+						result.containers.push_back(roaring::copy(a.chunk(i)));
+					}
+					++i;
+				}
+				else if(i == a.chunk_count() || b.chunk_key(j) < a.chunk_key(i))
+				{
+					if(keep_b)
+					{
+						result.keys.push_back(b.chunk_key(j));
+						result.containers.push_back(roaring::copy(b.chunk(j)));
+					}
+					++j;
+				}
+				else
+				{
+					auto c = operation(a.chunk(i), b.chunk(j));
+					if(c.cardinality != 0)
+					{
+						result.keys.push_back(a.chunk_key(i));
+						result.containers.push_back(std::move(c));
+					}
+					++i;
+					++j;
+				}
+			}
+			return result;
+		}
+
+		template <typename Roaring>
+		roaring_bitmap access::copy(const Roaring& r)
+		{
+			roaring_bitmap result;
+			result.keys.reserve(r.chunk_count());
+			result.containers.reserve(r.chunk_count());
+			for(std::size_t i = 0; i < r.chunk_count(); ++i)
+			{
+				result.keys.push_back(r.chunk_key(i));
+				result.containers.push_back(roaring::copy(r.chunk(i)));
+			}
+			return result;
+		}
+
+	} // namespace detail::roaring
+
+	template <typename Other>
+	roaring_bitmap& roaring_bitmap::operator|=(const Other& other)
+	{ return *this = *this | other; }
+
+	template <typename Other>
+	roaring_bitmap& roaring_bitmap::operator&=(const Other& other)
+	{ return *this = *this & other; }
+
+	template <typename Other>
+	roaring_bitmap& roaring_bitmap::operator-=(const Other& other)
+	{ return *this = *this - other; }
+
+} // namespace simple::support
+
+#endif /* end of include guard */
@@ -24,43 +24,84 @@ namespace simple::support
 	template <typename T>
 	constexpr bool has_tuple_interface_v = has_tuple_interface<T>::value;
 
-	// wow this is a mess... you think it'll be optimized? O_o
+	namespace detail
+	{
+		template <std::size_t I, typename F, typename... Tuples>
+		constexpr decltype(auto) apply_at(F&& f, Tuples&&... tuples)
+		{
+			return support::invoke(std::forward<F>(f), get<I>(std::forward<Tuples>(tuples))...);
+		}
+
+		// a table of functions, one per index, so dispatch is a single indirect call,
+		// they must all return the same type,
+		// a static member, since a local table would be filled in on every call
+		template <typename Indices, typename F, typename... Tuples>
+		struct apply_table;
+		template <std::size_t... I, typename F, typename... Tuples>
+		struct apply_table<std::index_sequence<I...>, F, Tuples...>
+		{
+			using result = decltype(apply_at<0>(std::declval<F>(), std::declval<Tuples>()...));
+			static constexpr result (*functions[])(F&&, Tuples&&...) = {&apply_at<I, F, Tuples...>...};
+		};
+
+		// for a few elements the comparisons are cheaper than an indirect call
+		template <std::size_t I, std::size_t Size, typename F, typename... Tuples>
+		constexpr decltype(auto) apply_chain(std::size_t index, F&& f, Tuples&&... tuples)
+		{
+			if constexpr (I + 1 < Size)
+				if(I != index)
+					return apply_chain<I + 1, Size>(index, std::forward<F>(f), std::forward<Tuples>(tuples)...);
+			return apply_at<I>(std::forward<F>(f), std::forward<Tuples>(tuples)...);
+		}
+
+		// measured with benchmarks/apply_for.cpp, the table wins from about here on
+		constexpr std::size_t apply_table_min_size = 16;
+
+		template <typename F, typename... Tuples, std::size_t... I>
+		constexpr decltype(auto) apply_for(std::size_t index, std::index_sequence<I...> indices, F&& f, Tuples&&... tuples)
+		{
+			assert(index < sizeof...(I) && "simple::support::apply_for - index out of bounds");
+			if constexpr (sizeof...(I) < apply_table_min_size)
+				return apply_chain<0, sizeof...(I)>(index, std::forward<F>(f), std::forward<Tuples>(tuples)...);
+			else
+			{
+				using table = apply_table<decltype(indices), F, Tuples...>;
+				return table::functions[index](std::forward<F>(f), std::forward<Tuples>(tuples)...);
+			}
+		}
+
+		// every index is known at compile time, so no dispatch at all, just a bounds check each
+		template <typename F, typename... Tuples, std::size_t... I>
+		constexpr void apply_for(range<std::size_t> index_range, std::index_sequence<I...>, F&& f, Tuples&&... tuples)
+		{
+			assert(index_range.upper() <= sizeof...(I) && "simple::support::apply_for - index out of bounds");
+			((index_range.lower() <= I && I < index_range.upper()
+				? void(apply_at<I>(f, std::forward<Tuples>(tuples)...))
+				: void()
+			), ...);
+		}
+	} // namespace detail
+
 	//TODO: return a variant
 	//TODO: rename to transform
-	template<typename F, typename First, size_t I = std::tuple_size_v<std::remove_reference_t<First>> - 1, typename... Rest>
+	template<typename F, typename First, typename... Rest>
 	constexpr
 	decltype(auto) apply_for(size_t index, F&& f, First&& first, Rest&&... rest)
 	{
-		using std::remove_reference_t;
-		using First_t = remove_reference_t<First>;
-		using std::get;
-		using std::tuple_element_t;
-		using std::forward;
-		static_assert(I >= 0 && I < std::tuple_size_v<First_t>);
-		if(I == index)
-			return support::invoke(forward<F>(f),
-					get<I>(std::forward<First>(first)),
-					get<I>(std::forward<Rest>(rest))...
-			);
-		if constexpr (I > 0)
-			return apply_for<F, decltype(forward<First_t>(first)), I - 1>(index, forward<F>(f),
-					forward<First_t>(first), forward<remove_reference_t<Rest>>(rest)...);
-
-		assert(!"simple::support::apply_for - index out of bounds");
+		return detail::apply_for(index,
+			std::make_index_sequence<std::tuple_size_v<std::remove_reference_t<First>>>{},
+			std::forward<F>(f), std::forward<First>(first), std::forward<Rest>(rest)...);
 	}
 
 	//TODO: return a tuple of variants
 	//TODO: rename to transform
-	template<typename F, typename First, size_t I = std::tuple_size_v<std::remove_reference_t<First>> - 1, typename... Rest>
+	template<typename F, typename First, typename... Rest>
 	constexpr
 	void apply_for(range<size_t> index_range, F&& f, First&& first, Rest&&... rest)
 	{
-		for(size_t i = index_range.lower(); i < index_range.upper(); ++i)
-		{
-			apply_for(i, std::forward<F>(f),
-				std::forward<std::remove_reference_t<First>>(first),
-				std::forward<std::remove_reference_t<Rest>>(rest)...);
-		}
+		detail::apply_for(index_range,
+			std::make_index_sequence<std::tuple_size_v<std::remove_reference_t<First>>>{},
+			std::forward<F>(f), std::forward<First>(first), std::forward<Rest>(rest)...);
 	}
 
 	template <typename First, typename... Rest>
@@ -42,11 +42,21 @@ namespace simple::support
 	}
 
 	template <typename Tuple>
-	using tuple_cdr_t = subtuple_t<Tuple,
-		cdr<tuple_indices<Tuple>> >;
+	struct tuple_cdr_meta
+	{
+		using type = subtuple_t<Tuple, cdr<tuple_indices<Tuple>>>;
+	};
+	template <typename First, typename... Rest>
+	struct tuple_cdr_meta<std::tuple<First, Rest...>>
+	{
+		using type = std::tuple<Rest...>;
+	};
+
+	template <typename Tuple>
+	using tuple_cdr_t = typename tuple_cdr_meta<Tuple>::type;
 
 	template <typename Tuple>
-	using tuple_car_t = std::tuple_element_t<0, Tuple>;
+	using tuple_car_t = detail::tuple_element_t<0, Tuple>;
 
 } // namespace simple::support
 
@@ -1,8 +1,16 @@
 #ifndef SIMPLE_SUPPORT_TUPLE_UTILS_COMMON_HPP
 #define SIMPLE_SUPPORT_TUPLE_UTILS_COMMON_HPP
 
+#include <cstddef>
+#include <tuple>
 #include <utility>
 
+#if defined __has_builtin
+#if __has_builtin(__type_pack_element)
+#define SIMPLE_SUPPORT_TUPLE_UTILS_BUILTIN_TYPE_PACK_ELEMENT
+#endif
+#endif
+
 namespace simple::support
 {
 
@@ -17,6 +25,41 @@ namespace simple::support
 		return std::forward<T>(x);
 	}
 
+	namespace detail
+	{
+#if defined SIMPLE_SUPPORT_TUPLE_UTILS_BUILTIN_TYPE_PACK_ELEMENT
+		template <std::size_t I, typename... Ts>
+		using pack_element_t = __type_pack_element<I, Ts...>;
+#else
+		// the type at an index of a pack, picked by overload resolution out of a base per element,
+		// instead of recursing through the pack, so the instantiation depth doesn't grow with it
+		template <std::size_t I, typename T>
+		struct indexed_type { using type = T; };
+
+		template <typename Indices, typename... Ts>
+		struct indexed_types;
+		template <std::size_t... I, typename... Ts>
+		struct indexed_types<std::index_sequence<I...>, Ts...> : indexed_type<I, Ts>... {};
+
+		template <std::size_t I, typename T>
+		indexed_type<I, T> select_indexed(const indexed_type<I, T>&);
+
+		// qualified, to avoid argument dependent lookup, that would complete every element type
+		template <std::size_t I, typename... Ts>
+		using pack_element_t = typename decltype(detail::select_indexed<I>(
+			std::declval<const indexed_types<std::index_sequence_for<Ts...>, Ts...>&>()))::type;
+#endif
+
+		// std::tuple elements go through the above, anything else through std::tuple_element
+		template <std::size_t I, typename Tuple>
+		struct tuple_element { using type = std::tuple_element_t<I, Tuple>; };
+		template <std::size_t I, typename... Ts>
+		struct tuple_element<I, std::tuple<Ts...>> { using type = pack_element_t<I, Ts...>; };
+
+		template <std::size_t I, typename Tuple>
+		using tuple_element_t = typename tuple_element<I, Tuple>::type;
+	} // namespace detail
+
 } // namespace simple::support
 
 
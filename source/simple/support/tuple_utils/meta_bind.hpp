@@ -3,6 +3,7 @@
 
 #include <type_traits>
 #include <tuple>
+#include "common.hpp"
 
 namespace simple::support
 {
@@ -82,7 +83,7 @@ namespace simple::support
 		std::index_sequence<Diff...>>
 	{
 		using type = std::tuple<Over...,
-			std::tuple_element_t<Diff+sizeof...(Over), std::tuple<Under...>>...>;
+			detail::pack_element_t<Diff+sizeof...(Over), Under...>...>;
 	};
 	template <typename Tuple1, typename Tuple2>
 	using overlap_t = typename overlap_meta<Tuple1, Tuple2>::type;
@@ -51,21 +51,57 @@ namespace simple::support
 	template<typename Functor, typename Tuple, size_t begin = 0>
 	using find_meta_t = typename find_meta<Functor, Tuple, begin>::type;
 
+	namespace detail
+	{
+		template <bool... Flags>
+		constexpr size_t first_true(size_t begin) noexcept
+		{
+			constexpr bool flags[] = {Flags..., false};
+			size_t i = begin;
+			while(i < sizeof...(Flags) && !flags[i])
+				++i;
+			return i;
+		}
+
+		// the predicate is applied to all the elements at once, with a pack expansion,
+		// instead of one by one through find_meta,
+		// so it must be well formed for every element, not only the ones before the match
+		template <template <typename...> typename Op, typename Tuple, size_t begin,
+			typename Indices = std::make_index_sequence<std::tuple_size_v<Tuple>>>
+		struct find_if_index;
+		template <template <typename...> typename Op, typename Tuple, size_t begin, size_t... I>
+		struct find_if_index<Op, Tuple, begin, std::index_sequence<I...>>
+		{
+			static_assert(begin <= sizeof...(I));
+			static constexpr size_t value = first_true<bool(Op<tuple_element_t<I, Tuple>>::value)...>(begin);
+		};
+		// no need to index a std::tuple, can expand its elements directly
+		template <template <typename...> typename Op, typename... Ts, size_t begin, size_t... I>
+		struct find_if_index<Op, std::tuple<Ts...>, begin, std::index_sequence<I...>>
+		{
+			static_assert(begin <= sizeof...(Ts));
+			static constexpr size_t value = first_true<bool(Op<Ts>::value)...>(begin);
+		};
+
+		template <typename T>
+		struct same_as
+		{
+			template <typename Other>
+			using function = std::is_same<T, Other>;
+		};
+	} // namespace detail
+
 	template<typename T, typename Tuple, size_t begin = 0>
-	constexpr auto find_v = find_meta_t<
-		bind_meta<std::is_same, T>,
+	constexpr auto find_v = detail::find_if_index<
+		detail::same_as<T>::template function,
 		Tuple, begin
 	>::value;
 
 	template<template <typename...> typename Op, typename Tuple, size_t begin = 0>
-	using find_if_t = typename find_meta_t<
-		bind_meta<Op>, Tuple, begin
-	>::type;
+	constexpr auto find_if_v = detail::find_if_index<Op, Tuple, begin>::value;
 
 	template<template <typename...> typename Op, typename Tuple, size_t begin = 0>
-	constexpr auto find_if_v = find_meta_t<
-		bind_meta<Op>, Tuple, begin
-	>::value;
+	using find_if_t = detail::tuple_element_t<find_if_v<Op, Tuple, begin>, Tuple>;
 
 } // namespace simple::support
 
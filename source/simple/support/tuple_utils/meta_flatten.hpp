@@ -1,6 +1,7 @@
 #ifndef SIMPLE_SUPPORT_TUPLE_UTILS_META_FLATTEN_HPP
 #define SIMPLE_SUPPORT_TUPLE_UTILS_META_FLATTEN_HPP
 
+#include <array>
 #include "meta_find.hpp"
 #include "pend.hpp"
 
@@ -22,13 +23,57 @@ namespace simple::support
 		using binding = concat_t<Result, typename Op::template function<T>::type>;
 	};
 
+	namespace detail
+	{
+		// every element of the result is looked up directly by its position in the operator results,
+		// instead of accumulating them one tuple at a time
+		template <typename... Tuples>
+		struct flatten_tuples
+		{
+			struct position { size_t outer, inner; };
+
+			static constexpr size_t size = (size_t{} + ... + std::tuple_size_v<Tuples>);
+
+			static constexpr auto positions = []()
+			{
+				constexpr size_t sizes[] = {std::tuple_size_v<Tuples>..., 0};
+				std::array<position, size> result{};
+				size_t i = 0;
+				for(size_t outer = 0; outer < sizeof...(Tuples); ++outer)
+					for(size_t inner = 0; inner < sizes[outer]; ++inner)
+						result[i++] = {outer, inner};
+				return result;
+			}();
+
+			template <size_t... I>
+			static auto elements(std::index_sequence<I...>) -> std::tuple<
+				tuple_element_t<positions[I].inner,
+					pack_element_t<positions[I].outer, Tuples...>>...
+			>;
+
+			using type = decltype(elements(std::make_index_sequence<size>{}));
+		};
+
+		template <typename Tuple, template <typename...> typename Operator,
+			typename Indices = std::make_index_sequence<std::tuple_size_v<Tuple>>>
+		struct flatten;
+		template <typename Tuple, template <typename...> typename Operator, size_t... I>
+		struct flatten<Tuple, Operator, std::index_sequence<I...>>
+		{
+			using type = typename flatten_tuples<
+				typename Operator<tuple_element_t<I, Tuple>>::type...
+			>::type;
+		};
+		template <typename... Ts, template <typename...> typename Operator, size_t... I>
+		struct flatten<std::tuple<Ts...>, Operator, std::index_sequence<I...>>
+		{
+			using type = typename flatten_tuples<typename Operator<Ts>::type...>::type;
+		};
+	} // namespace detail
+
 	template <typename Tuple, template <typename...> typename Operator =
 		flatten_meta_operator_default>
-	using flatten_t = typename find_meta_t
-	<
-		bind_meta<flatten_meta_find_adapter, std::tuple<>, bind_meta<Operator>>,
-		Tuple
-	>::functor::binding;
+	using flatten_t = typename detail::flatten<Tuple, Operator>::type;
 
 } // namespace simple::support
 
@@ -2,6 +2,7 @@
 #define SIMPLE_SUPPORT_TUPLE_UTILS_SUBTUPLE_HPP
 #include <utility>
 #include <tuple>
+#include "common.hpp"
 
 namespace simple::support
 {
@@ -10,7 +11,7 @@ namespace simple::support
 	template <typename Tuple, size_t... indices>
 	struct subtuple_meta<Tuple, std::integer_sequence<size_t, indices...>>
 	{
-		using type = std::tuple<std::tuple_element_t<indices, Tuple>...>;
+		using type = std::tuple<detail::tuple_element_t<indices, Tuple>...>;
 	};
 	template <typename Tuple, typename Range>
 	using subtuple_t = typename subtuple_meta<Tuple, Range>::type;;
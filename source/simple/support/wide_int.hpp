@@ -0,0 +1,794 @@
+#ifndef SIMPLE_SUPPORT_WIDE_INT_HPP
+#define SIMPLE_SUPPORT_WIDE_INT_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "arithmetic.hpp"
+#include "bits.hpp"
+#include "int_literals.hpp"
+
+#if defined __SIZEOF_INT128__ && !defined SIMPLE_SUPPORT_WIDE_INT_DISABLE_INT128
+#define SIMPLE_SUPPORT_WIDE_INT_INT128
+#endif
+
+namespace simple::support
+{
+
+	template <std::size_t Bits> class wide_uint;
+	template <std::size_t Bits> class wide_int;
+
+	namespace detail::wide
+	{
+
+		using limb = std::uint64_t;
+		constexpr std::size_t limb_bits = std::numeric_limits<limb>::digits;
+
+		// full 128 bit product, returns the low half
+		constexpr limb mul_full(limb one, limb other, limb& high) noexcept
+		{
+#if defined SIMPLE_SUPPORT_WIDE_INT_INT128
+			__extension__ using uint128_t = unsigned __int128;
+			const uint128_t product = uint128_t(one) * other;
+			high = limb(product >> limb_bits);
+			return limb(product);
+#else
+			constexpr limb half_mask = 0xffff'ffff;
+			const limb one_low = one & half_mask, one_high = one >> 32;
+			const limb other_low = other & half_mask, other_high = other >> 32;
+			const limb low_low = one_low * other_low;
+			const limb low_high = one_low * other_high;
+			const limb high_low = one_high * other_low;
+			const limb high_high = one_high * other_high;
+			const limb middle = (low_low >> 32) + (low_high & half_mask) + (high_low & half_mask);
+			high = high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32);
+			return (middle << 32) | (low_low & half_mask);
+#endif
+		}
+
+		// divides 128 bit number by a 64 bit one, the quotient must fit in 64 bits (high < divisor)
+		constexpr limb div_full(limb high, limb low, limb divisor, limb& remainder) noexcept
+		{
+			assert(high < divisor);
+#if defined SIMPLE_SUPPORT_WIDE_INT_INT128
+			__extension__ using uint128_t = unsigned __int128;
+			const uint128_t dividend = (uint128_t(high) << limb_bits) | low;
+			remainder = limb(dividend % divisor);
+			return limb(dividend / divisor);
+#else
+			// Knuth's algorithm D with two 32 bit digits, as in Hacker's Delight (divlu)
+			constexpr limb base = limb{1} << 32;
+			constexpr limb half_mask = base - 1;
+			const int shift = count_leading_zeros(divisor);
+			divisor <<= shift;
+			const limb divisor_high = divisor >> 32;
+			const limb divisor_low = divisor & half_mask;
+			const limb numerator_high = shift == 0 ? high : (high << shift) | (low >> (limb_bits - shift));
+			const limb numerator_low = low << shift;
+			const limb numerator_1 = numerator_low >> 32;
+			const limb numerator_0 = numerator_low & half_mask;
+
+			limb quotient_1 = numerator_high / divisor_high;
+			limb estimate = numerator_high - quotient_1 * divisor_high;
+			while(quotient_1 >= base || quotient_1 * divisor_low > base * estimate + numerator_1)
+			{
+				--quotient_1;
+				estimate += divisor_high;
+				if(estimate >= base)
+					break;
+			}
+
+			const limb partial = numerator_high * base + numerator_1 - quotient_1 * divisor;
+			limb quotient_0 = partial / divisor_high;
+			estimate = partial - quotient_0 * divisor_high;
+			while(quotient_0 >= base || quotient_0 * divisor_low > base * estimate + numerator_0)
+			{
+				--quotient_0;
+				estimate += divisor_high;
+				if(estimate >= base)
+					break;
+			}
+
+			remainder = (partial * base + numerator_0 - quotient_0 * divisor) >> shift;
+			return quotient_1 * base + quotient_0;
+#endif
+		}
+
+		// out = one + other, returns carry
+		constexpr bool add(limb* out, const limb* one, const limb* other, std::size_t size) noexcept
+		{
+			bool carry = false;
+			for(std::size_t i = 0; i < size; ++i)
+			{
+				limb sum{};
+				const bool overflow = add_overflow(sum, one[i], other[i]);
+				carry = add_overflow(out[i], sum, limb(carry)) | overflow;
+			}
+			return carry;
+		}
+
+		// out = one - other, returns borrow
+		constexpr bool sub(limb* out, const limb* one, const limb* other, std::size_t size) noexcept
+		{
+			bool borrow = false;
+			for(std::size_t i = 0; i < size; ++i)
+			{
+				limb difference{};
+				const bool overflow = sub_overflow(difference, one[i], other[i]);
+				borrow = sub_overflow(out[i], difference, limb(borrow)) | overflow;
+			}
+			return borrow;
+		}
+
+		// target += source, where source is not longer than target, returns carry out of the target
+		constexpr bool add_into(limb* target, std::size_t target_size,
+			const limb* source, std::size_t source_size) noexcept
+		{
+			assert(source_size <= target_size);
+			bool carry = add(target, target, source, source_size);
+			for(std::size_t i = source_size; carry && i < target_size; ++i)
+				carry = add_overflow(target[i], limb{1});
+			return carry;
+		}
+
+		constexpr bool sub_from(limb* target, std::size_t target_size,
+			const limb* source, std::size_t source_size) noexcept
+		{
+			assert(source_size <= target_size);
+			bool borrow = sub(target, target, source, source_size);
+			for(std::size_t i = source_size; borrow && i < target_size; ++i)
+				borrow = sub_overflow(target[i], limb{1});
+			return borrow;
+		}
+
+		// out must have size + other_size limbs, and be zeroed
+		// or if truncate is set, only size limbs are computed
+		constexpr void schoolbook(limb* out, const limb* one, std::size_t size,
+			const limb* other, std::size_t other_size, bool truncate = false) noexcept
+		{
+			for(std::size_t i = 0; i < size; ++i)
+			{
+				limb carry = 0;
+				const std::size_t end = truncate ? size - i : other_size;
+				for(std::size_t j = 0; j < end && j < other_size; ++j)
+				{
+					limb high = 0;
+					limb low = mul_full(one[i], other[j], high);
+					// can't overflow, (2^n - 1)^2 + 2(2^n - 1) = 2^2n - 1
+					high += add_overflow(low, out[i + j]);
+					high += add_overflow(low, carry);
+					out[i + j] = low;
+					carry = high;
+				}
+				if(!truncate)
+					out[i + other_size] = carry;
+			}
+		}
+
+		// below this schoolbook is faster
+		constexpr std::size_t karatsuba_threshold = 4;
+
+		// three half size multiplications instead of four:
+		// (a1 B + a0)(b1 B + b0) = a1 b1 B^2 + ((a0 + a1)(b0 + b1) - a0 b0 - a1 b1) B + a0 b0
+		template <std::size_t Size>
+		constexpr void full_product(limb (&out)[2 * Size], const limb (&one)[Size], const limb (&other)[Size]) noexcept
+		{
+			if constexpr (Size <= karatsuba_threshold || Size % 2 != 0)
+			{
+				for(auto& x : out)
+					x = 0;
+				schoolbook(out, one, Size, other, Size);
+			}
+			else
+			{
+				constexpr std::size_t half = Size / 2;
+				limb one_low[half]{}, one_high[half]{}, other_low[half]{}, other_high[half]{};
+				for(std::size_t i = 0; i < half; ++i)
+				{
+					one_low[i] = one[i];
+					one_high[i] = one[half + i];
+					other_low[i] = other[i];
+					other_high[i] = other[half + i];
+				}
+
+				limb low[Size]{}, high[Size]{};
+				full_product<half>(low, one_low, other_low);
+				full_product<half>(high, one_high, other_high);
+
+				// the sums can carry into one extra bit each
+				limb one_sum[half]{}, other_sum[half]{};
+				const bool one_carry = add(one_sum, one_low, one_high, half);
+				const bool other_carry = add(other_sum, other_low, other_high, half);
+				limb sums_product[Size]{};
+				full_product<half>(sums_product, one_sum, other_sum);
+				limb middle[Size + 1]{};
+				for(std::size_t i = 0; i < Size; ++i)
+					middle[i] = sums_product[i];
+				if(one_carry)
+					add_into(middle + half, Size + 1 - half, other_sum, half);
+				if(other_carry)
+					add_into(middle + half, Size + 1 - half, one_sum, half);
+				if(one_carry && other_carry)
+					++middle[Size];
+				sub_from(middle, Size + 1, low, Size);
+				sub_from(middle, Size + 1, high, Size);
+
+				for(std::size_t i = 0; i < Size; ++i)
+				{
+					out[i] = low[i];
+					out[Size + i] = high[i];
+				}
+				add_into(out + half, 2 * Size - half, middle, Size + 1);
+			}
+		}
+
+		template <typename Int>
+		constexpr bool is_int_v = std::is_integral_v<Int> && not std::is_same_v<Int, bool>;
+
+	} // namespace detail::wide
+
+	// fixed size unsigned integer made of 64 bit words,
+	// least significant first
+	template <std::size_t Bits>
+	class wide_uint
+	{
+		static_assert(Bits % 64 == 0 && Bits >= 128, "Bits must be a multiple of 64, at least 128.");
+
+		public:
+		using limb = detail::wide::limb;
+		static constexpr std::size_t limbs = Bits / detail::wide::limb_bits;
+
+		limb words[limbs]{};
+
+		constexpr wide_uint() noexcept = default;
+
+		// sign extends negative values, same as converting to builtin unsigned types
+		template <typename Int, std::enable_if_t<detail::wide::is_int_v<Int>>* = nullptr>
+		constexpr wide_uint(Int value) noexcept
+		{
+			words[0] = limb(value);
+			const limb extension = value < Int{0} ? ~limb{} : limb{};
+			for(std::size_t i = 1; i < limbs; ++i)
+				words[i] = extension;
+		}
+
+		// truncates or zero extends
+		template <std::size_t OtherBits, std::enable_if_t<OtherBits != Bits>* = nullptr>
+		constexpr explicit wide_uint(const wide_uint<OtherBits>& other) noexcept
+		{
+			for(std::size_t i = 0; i < limbs && i < other.limbs; ++i)
+				words[i] = other.words[i];
+		}
+
+		template <typename Int, std::enable_if_t<detail::wide::is_int_v<Int>>* = nullptr>
+		[[nodiscard]] constexpr explicit operator Int() const noexcept
+		{ return Int(words[0]); }
+
+		[[nodiscard]] constexpr explicit operator bool() const noexcept
+		{
+			for(auto word : words)
+				if(word != 0)
+					return true;
+			return false;
+		}
+
+		[[nodiscard]] friend constexpr wide_uint operator+(const wide_uint& one, const wide_uint& other) noexcept
+		{
+			wide_uint result;
+			detail::wide::add(result.words, one.words, other.words, limbs);
+			return result;
+		}
+
+		[[nodiscard]] friend constexpr wide_uint operator-(const wide_uint& one, const wide_uint& other) noexcept
+		{
+			wide_uint result;
+			detail::wide::sub(result.words, one.words, other.words, limbs);
+			return result;
+		}
+
+		// low half of the product only
+		[[nodiscard]] friend constexpr wide_uint operator*(const wide_uint& one, const wide_uint& other) noexcept
+		{
+			wide_uint result;
+			detail::wide::schoolbook(result.words, one.words, limbs, other.words, limbs, true);
+			return result;
+		}
+
+		[[nodiscard]] friend constexpr wide_uint operator/(const wide_uint& one, const wide_uint& other) noexcept
+		{
+			wide_uint quotient, remainder;
+			divide(one, other, quotient, remainder);
+			return quotient;
+		}
+
+		[[nodiscard]] friend constexpr wide_uint operator%(const wide_uint& one, const wide_uint& other) noexcept
+		{
+			wide_uint quotient, remainder;
+			divide(one, other, quotient, remainder);
+			return remainder;
+		}
+
+		[[nodiscard]] friend constexpr wide_uint operator-(const wide_uint& one) noexcept
+		{ return wide_uint{} - one; }
+
+		[[nodiscard]] friend constexpr wide_uint operator~(const wide_uint& one) noexcept
+		{
+			wide_uint result;
+			for(std::size_t i = 0; i < limbs; ++i)
+				result.words[i] = ~one.words[i];
+			return result;
+		}
+
+		[[nodiscard]] friend constexpr wide_uint operator&(const wide_uint& one, const wide_uint& other) noexcept
+		{
+			wide_uint result;
+			for(std::size_t i = 0; i < limbs; ++i)
+				result.words[i] = one.words[i] & other.words[i];
+			return result;
+		}
+
+		[[nodiscard]] friend constexpr wide_uint operator|(const wide_uint& one, const wide_uint& other) noexcept
+		{
+			wide_uint result;
+			for(std::size_t i = 0; i < limbs; ++i)
+				result.words[i] = one.words[i] | other.words[i];
+			return result;
+		}
+
+		[[nodiscard]] friend constexpr wide_uint operator^(const wide_uint& one, const wide_uint& other) noexcept
+		{
+			wide_uint result;
+			for(std::size_t i = 0; i < limbs; ++i)
+				result.words[i] = one.words[i] ^ other.words[i];
+			return result;
+		}
+
+		[[nodiscard]] friend constexpr wide_uint operator<<(const wide_uint& one, std::size_t shift) noexcept
+		{
+			assert(shift < Bits);
+			constexpr auto limb_bits = detail::wide::limb_bits;
+			const std::size_t limb_shift = shift / limb_bits;
+			const std::size_t bit_shift = shift % limb_bits;
+			wide_uint result;
+			for(std::size_t i = limbs; i-- > limb_shift;)
+			{
+				result.words[i] = one.words[i - limb_shift] << bit_shift;
+				if(bit_shift != 0 && i > limb_shift)
+					result.words[i] |= one.words[i - limb_shift - 1] >> (limb_bits - bit_shift);
+			}
+			return result;
+		}
+
+		[[nodiscard]] friend constexpr wide_uint operator>>(const wide_uint& one, std::size_t shift) noexcept
+		{
+			assert(shift < Bits);
+			constexpr auto limb_bits = detail::wide::limb_bits;
+			const std::size_t limb_shift = shift / limb_bits;
+			const std::size_t bit_shift = shift % limb_bits;
+			wide_uint result;
+			for(std::size_t i = 0; i + limb_shift < limbs; ++i)
+			{
+				result.words[i] = one.words[i + limb_shift] >> bit_shift;
+				if(bit_shift != 0 && i + limb_shift + 1 < limbs)
+					result.words[i] |= one.words[i + limb_shift + 1] << (limb_bits - bit_shift);
+			}
+			return result;
+		}
+
+		[[nodiscard]] friend constexpr bool operator==(const wide_uint& one, const wide_uint& other) noexcept
+		{
+			for(std::size_t i = 0; i < limbs; ++i)
+				if(one.words[i] != other.words[i])
+					return false;
+			return true;
+		}
+
+		[[nodiscard]] friend constexpr bool operator<(const wide_uint& one, const wide_uint& other) noexcept
+		{
+			for(std::size_t i = limbs; i-- > 0;)
+				if(one.words[i] != other.words[i])
+					return one.words[i] < other.words[i];
+			return false;
+		}
+
+		[[nodiscard]] friend constexpr bool operator!=(const wide_uint& one, const wide_uint& other) noexcept
+		{ return !(one == other); }
+		[[nodiscard]] friend constexpr bool operator>(const wide_uint& one, const wide_uint& other) noexcept
+		{ return other < one; }
+		[[nodiscard]] friend constexpr bool operator<=(const wide_uint& one, const wide_uint& other) noexcept
+		{ return !(other < one); }
+		[[nodiscard]] friend constexpr bool operator>=(const wide_uint& one, const wide_uint& other) noexcept
+		{ return !(one < other); }
+
+		friend constexpr wide_uint& operator+=(wide_uint& one, const wide_uint& other) noexcept
+		{
+			detail::wide::add(one.words, one.words, other.words, limbs);
+			return one;
+		}
+
+		friend constexpr wide_uint& operator-=(wide_uint& one, const wide_uint& other) noexcept
+		{
+			detail::wide::sub(one.words, one.words, other.words, limbs);
+			return one;
+		}
+
+		friend constexpr wide_uint& operator*=(wide_uint& one, const wide_uint& other) noexcept
+		{ return one = one * other; }
+		friend constexpr wide_uint& operator/=(wide_uint& one, const wide_uint& other) noexcept
+		{ return one = one / other; }
+		friend constexpr wide_uint& operator%=(wide_uint& one, const wide_uint& other) noexcept
+		{ return one = one % other; }
+		friend constexpr wide_uint& operator&=(wide_uint& one, const wide_uint& other) noexcept
+		{ return one = one & other; }
+		friend constexpr wide_uint& operator|=(wide_uint& one, const wide_uint& other) noexcept
+		{ return one = one | other; }
+		friend constexpr wide_uint& operator^=(wide_uint& one, const wide_uint& other) noexcept
+		{ return one = one ^ other; }
+		friend constexpr wide_uint& operator<<=(wide_uint& one, std::size_t shift) noexcept
+		{ return one = one << shift; }
+		friend constexpr wide_uint& operator>>=(wide_uint& one, std::size_t shift) noexcept
+		{ return one = one >> shift; }
+
+		constexpr wide_uint& operator++() noexcept
+		{
+			for(std::size_t i = 0; i < limbs && add_overflow(words[i], limb{1}); ++i);
+			return *this;
+		}
+
+		constexpr wide_uint& operator--() noexcept
+		{
+			for(std::size_t i = 0; i < limbs && sub_overflow(words[i], limb{1}); ++i);
+			return *this;
+		}
+
+		constexpr wide_uint operator++(int) noexcept
+		{
+			auto previous = *this;
+			++(*this);
+			return previous;
+		}
+
+		constexpr wide_uint operator--(int) noexcept
+		{
+			auto previous = *this;
+			--(*this);
+			return previous;
+		}
+
+		// quotient and remainder of division by a single word, the fast case
+		constexpr limb divide(limb divisor) noexcept
+		{
+			assert(divisor != 0);
+			limb remainder = 0;
+			for(std::size_t i = limbs; i-- > 0;)
+				words[i] = detail::wide::div_full(remainder, words[i], divisor, remainder);
+			return remainder;
+		}
+
+		static constexpr void divide(const wide_uint& dividend, const wide_uint& divisor,
+			wide_uint& quotient, wide_uint& remainder) noexcept
+		{
+			assert(divisor && "Division by zero.");
+			if(bit_width(divisor) <= int(detail::wide::limb_bits))
+			{
+				quotient = dividend;
+				remainder = quotient.divide(divisor.words[0]);
+				return;
+			}
+
+			// shift and subtract, one bit at a time,
+			// starting where the divisor first fits
+			quotient = wide_uint{};
+			remainder = wide_uint{};
+			const int width = bit_width(dividend);
+			for(int i = width; i-- > 0;)
+			{
+				remainder <<= 1;
+				remainder.words[0] |= (dividend.words[i / detail::wide::limb_bits] >> (i % detail::wide::limb_bits)) & 1;
+				if(remainder >= divisor)
+				{
+					remainder -= divisor;
+					quotient.words[i / detail::wide::limb_bits] |= limb{1} << (i % detail::wide::limb_bits);
+				}
+			}
+		}
+	};
+
+	template <std::size_t Bits>
+	[[nodiscard]] constexpr int bit_width(const wide_uint<Bits>& value) noexcept
+	{
+		for(std::size_t i = wide_uint<Bits>::limbs; i-- > 0;)
+			if(value.words[i] != 0)
+				return int(i * detail::wide::limb_bits) + bit_width(value.words[i]);
+		return 0;
+	}
+
+	// double width product, Karatsuba for wider numbers
+	template <std::size_t Bits>
+	[[nodiscard]] constexpr wide_uint<2 * Bits> full_product(const wide_uint<Bits>& one, const wide_uint<Bits>& other) noexcept
+	{
+		wide_uint<2 * Bits> result;
+		detail::wide::full_product<wide_uint<Bits>::limbs>(result.words, one.words, other.words);
+		return result;
+	}
+
+	[[nodiscard]] constexpr wide_uint<128> full_product(std::uint64_t one, std::uint64_t other) noexcept
+	{
+		wide_uint<128> result;
+		result.words[0] = detail::wide::mul_full(one, other, result.words[1]);
+		return result;
+	}
+
+	// high half of the double width product
+	[[nodiscard]] constexpr std::uint64_t mul_high(std::uint64_t one, std::uint64_t other) noexcept
+	{
+		std::uint64_t high = 0;
+		detail::wide::mul_full(one, other, high);
+		return high;
+	}
+
+	template <std::size_t Bits>
+	[[nodiscard]] constexpr wide_uint<Bits> mul_high(const wide_uint<Bits>& one, const wide_uint<Bits>& other) noexcept
+	{
+		return wide_uint<Bits>(full_product(one, other) >> Bits);
+	}
+
+	template <std::size_t Bits>
+	constexpr bool add_overflow(wide_uint<Bits>& result, const wide_uint<Bits>& one, const wide_uint<Bits>& other) noexcept
+	{
+		return detail::wide::add(result.words, one.words, other.words, wide_uint<Bits>::limbs);
+	}
+
+	template <std::size_t Bits>
+	constexpr bool sub_overflow(wide_uint<Bits>& result, const wide_uint<Bits>& one, const wide_uint<Bits>& other) noexcept
+	{
+		return detail::wide::sub(result.words, one.words, other.words, wide_uint<Bits>::limbs);
+	}
+
+	template <std::size_t Bits>
+	constexpr bool mul_overflow(wide_uint<Bits>& result, const wide_uint<Bits>& one, const wide_uint<Bits>& other) noexcept
+	{
+		const auto product = full_product(one, other);
+		result = wide_uint<Bits>(product);
+		return bool(product >> Bits);
+	}
+
+	// two's complement on top of wide_uint
+	template <std::size_t Bits>
+	class wide_int
+	{
+		public:
+		using unsigned_type = wide_uint<Bits>;
+		using limb = typename unsigned_type::limb;
+		static constexpr std::size_t limbs = unsigned_type::limbs;
+
+		unsigned_type bits;
+
+		constexpr wide_int() noexcept = default;
+
+		template <typename Int, std::enable_if_t<detail::wide::is_int_v<Int>>* = nullptr>
+		constexpr wide_int(Int value) noexcept : bits(value)
+		{
+			// bits constructor sign extends negative values, but not large unsigned ones
+		}
+
+		constexpr explicit wide_int(const unsigned_type& bits) noexcept : bits(bits) {}
+
+		template <std::size_t OtherBits, std::enable_if_t<OtherBits != Bits>* = nullptr>
+		constexpr explicit wide_int(const wide_int<OtherBits>& other) noexcept : bits(other.bits)
+		{
+			// sign extend
+			if(other.negative())
+				for(std::size_t i = other.limbs; i < limbs; ++i)
+					bits.words[i] = ~limb{};
+		}
+
+		[[nodiscard]] constexpr bool negative() const noexcept
+		{ return bits.words[limbs - 1] >> (detail::wide::limb_bits - 1); }
+
+		[[nodiscard]] constexpr unsigned_type magnitude() const noexcept
+		{ return negative() ? -bits : bits; }
+
+		template <typename Int, std::enable_if_t<detail::wide::is_int_v<Int>>* = nullptr>
+		[[nodiscard]] constexpr explicit operator Int() const noexcept
+		{ return Int(bits.words[0]); }
+
+		[[nodiscard]] constexpr explicit operator bool() const noexcept
+		{ return bool(bits); }
+
+		[[nodiscard]] friend constexpr wide_int operator+(const wide_int& one, const wide_int& other) noexcept
+		{ return wide_int(one.bits + other.bits); }
+
+		[[nodiscard]] friend constexpr wide_int operator-(const wide_int& one, const wide_int& other) noexcept
+		{ return wide_int(one.bits - other.bits); }
+
+		[[nodiscard]] friend constexpr wide_int operator*(const wide_int& one, const wide_int& other) noexcept
+		{ return wide_int(one.bits * other.bits); }
+
+		// truncates towards zero like builtin types
+		[[nodiscard]] friend constexpr wide_int operator/(const wide_int& one, const wide_int& other) noexcept
+		{
+			const auto quotient = wide_int(one.magnitude() / other.magnitude());
+			return one.negative() != other.negative() ? -quotient : quotient;
+		}
+
+		// has the sign of the dividend
+		[[nodiscard]] friend constexpr wide_int operator%(const wide_int& one, const wide_int& other) noexcept
+		{
+			const auto remainder = wide_int(one.magnitude() % other.magnitude());
+			return one.negative() ? -remainder : remainder;
+		}
+
+		[[nodiscard]] friend constexpr wide_int operator-(const wide_int& one) noexcept
+		{ return wide_int(-one.bits); }
+
+		[[nodiscard]] friend constexpr wide_int operator~(const wide_int& one) noexcept
+		{ return wide_int(~one.bits); }
+
+		[[nodiscard]] friend constexpr wide_int operator&(const wide_int& one, const wide_int& other) noexcept
+		{ return wide_int(one.bits & other.bits); }
+
+		[[nodiscard]] friend constexpr wide_int operator|(const wide_int& one, const wide_int& other) noexcept
+		{ return wide_int(one.bits | other.bits); }
+
+		[[nodiscard]] friend constexpr wide_int operator^(const wide_int& one, const wide_int& other) noexcept
+		{ return wide_int(one.bits ^ other.bits); }
+
+		[[nodiscard]] friend constexpr wide_int operator<<(const wide_int& one, std::size_t shift) noexcept
+		{ return wide_int(one.bits << shift); }
+
+		// arithmetic shift, fills with the sign
+		[[nodiscard]] friend constexpr wide_int operator>>(const wide_int& one, std::size_t shift) noexcept
+		{
+			auto result = wide_int(one.bits >> shift);
+			if(one.negative() && shift != 0)
+				result.bits |= ~(~unsigned_type{} >> shift);
+			return result;
+		}
+
+		[[nodiscard]] friend constexpr bool operator==(const wide_int& one, const wide_int& other) noexcept
+		{ return one.bits == other.bits; }
+
+		// flipping the sign bits maps the order to unsigned one
+		[[nodiscard]] friend constexpr bool operator<(const wide_int& one, const wide_int& other) noexcept
+		{
+			return one.negative() != other.negative()
+				? one.negative()
+				: one.bits < other.bits;
+		}
+
+		[[nodiscard]] friend constexpr bool operator!=(const wide_int& one, const wide_int& other) noexcept
+		{ return !(one == other); }
+		[[nodiscard]] friend constexpr bool operator>(const wide_int& one, const wide_int& other) noexcept
+		{ return other < one; }
+		[[nodiscard]] friend constexpr bool operator<=(const wide_int& one, const wide_int& other) noexcept
+		{ return !(other < one); }
+		[[nodiscard]] friend constexpr bool operator>=(const wide_int& one, const wide_int& other) noexcept
+		{ return !(one < other); }
+
+		friend constexpr wide_int& operator+=(wide_int& one, const wide_int& other) noexcept
+		{ one.bits += other.bits; return one; }
+		friend constexpr wide_int& operator-=(wide_int& one, const wide_int& other) noexcept
+		{ one.bits -= other.bits; return one; }
+		friend constexpr wide_int& operator*=(wide_int& one, const wide_int& other) noexcept
+		{ return one = one * other; }
+		friend constexpr wide_int& operator/=(wide_int& one, const wide_int& other) noexcept
+		{ return one = one / other; }
+		friend constexpr wide_int& operator%=(wide_int& one, const wide_int& other) noexcept
+		{ return one = one % other; }
+		friend constexpr wide_int& operator&=(wide_int& one, const wide_int& other) noexcept
+		{ return one = one & other; }
+		friend constexpr wide_int& operator|=(wide_int& one, const wide_int& other) noexcept
+		{ return one = one | other; }
+		friend constexpr wide_int& operator^=(wide_int& one, const wide_int& other) noexcept
+		{ return one = one ^ other; }
+		friend constexpr wide_int& operator<<=(wide_int& one, std::size_t shift) noexcept
+		{ return one = one << shift; }
+		friend constexpr wide_int& operator>>=(wide_int& one, std::size_t shift) noexcept
+		{ return one = one >> shift; }
+
+		constexpr wide_int& operator++() noexcept { ++bits; return *this; }
+		constexpr wide_int& operator--() noexcept { --bits; return *this; }
+		constexpr wide_int operator++(int) noexcept { auto previous = *this; ++bits; return previous; }
+		constexpr wide_int operator--(int) noexcept { auto previous = *this; --bits; return previous; }
+	};
+
+	template <std::size_t Bits>
+	constexpr bool add_overflow(wide_int<Bits>& result, const wide_int<Bits>& one, const wide_int<Bits>& other) noexcept
+	{
+		result = one + other;
+		// same sign in, different sign out
+		return one.negative() == other.negative() && result.negative() != one.negative();
+	}
+
+	template <std::size_t Bits>
+	constexpr bool sub_overflow(wide_int<Bits>& result, const wide_int<Bits>& one, const wide_int<Bits>& other) noexcept
+	{
+		result = one - other;
+		return one.negative() != other.negative() && result.negative() != one.negative();
+	}
+
+	template <std::size_t Bits>
+	constexpr bool mul_overflow(wide_int<Bits>& result, const wide_int<Bits>& one, const wide_int<Bits>& other) noexcept
+	{
+		const auto product = full_product(one.magnitude(), other.magnitude());
+		const bool negative = one.negative() != other.negative();
+		const auto low = wide_uint<Bits>(product);
+		result = wide_int<Bits>(negative ? -low : low);
+		if(product >> Bits)
+			return true;
+		// magnitude of min is one more than max
+		const auto limit = wide_uint<Bits>(1) << (Bits - 1);
+		return negative ? low > limit : low >= limit;
+	}
+
+} // namespace simple::support
+
+template <std::size_t Bits>
+class std::numeric_limits<simple::support::wide_uint<Bits>>
+{
+	using type = simple::support::wide_uint<Bits>;
+	public:
+	static constexpr bool is_specialized = true;
+	static constexpr bool is_signed = false;
+	static constexpr bool is_integer = true;
+	static constexpr bool is_exact = true;
+	static constexpr bool is_modulo = true;
+	static constexpr int radix = 2;
+	static constexpr int digits = Bits;
+	static constexpr type min() noexcept { return type{}; }
+	static constexpr type lowest() noexcept { return type{}; }
+	static constexpr type max() noexcept { return ~type{}; }
+};
+
+template <std::size_t Bits>
+class std::numeric_limits<simple::support::wide_int<Bits>>
+{
+	using type = simple::support::wide_int<Bits>;
+	public:
+	static constexpr bool is_specialized = true;
+	static constexpr bool is_signed = true;
+	static constexpr bool is_integer = true;
+	static constexpr bool is_exact = true;
+	static constexpr bool is_modulo = false;
+	static constexpr int radix = 2;
+	static constexpr int digits = Bits - 1;
+	static constexpr type min() noexcept { return type(simple::support::wide_uint<Bits>(1) << (Bits - 1)); }
+	static constexpr type lowest() noexcept { return min(); }
+	static constexpr type max() noexcept { return type(~simple::support::wide_uint<Bits>{} >> 1); }
+};
+
+namespace simple::support::literals
+{
+
+	template<char... chars>
+	constexpr wide_uint<128> operator"" _u128()
+	{
+		return details::parse_literal<wide_uint<128>, chars...>();
+	}
+
+	template<char... chars>
+	constexpr wide_uint<256> operator"" _u256()
+	{
+		return details::parse_literal<wide_uint<256>, chars...>();
+	}
+
+	// negative values with unary minus, so the minimum is out of reach, same as with built in literals
+	template<char... chars>
+	constexpr wide_int<128> operator"" _i128()
+	{
+		return details::parse_literal<wide_int<128>, chars...>();
+	}
+
+	template<char... chars>
+	constexpr wide_int<256> operator"" _i256()
+	{
+		return details::parse_literal<wide_int<256>, chars...>();
+	}
+
+} // namespace simple::support::literals
+
+#endif /* end of include guard */
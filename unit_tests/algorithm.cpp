@@ -4,6 +4,7 @@
 #include <vector>
 #include <numeric>
 #include "simple/support/algorithm.hpp"
+#include "simple/support/rational.hpp"
 
 
 using namespace simple;
@@ -176,6 +177,131 @@ void Average()
 	static_assert( noexcept(average(1,2.0,3.f)) );
 }
 
+template <typename Number>
+void check_wrapper(std::initializer_list<Number> limits, std::initializer_list<Number> values)
+{
+	for(auto&& limit : limits)
+	{
+		const auto wrapper = support::wrapper(limit);
+		assert( wrapper.limit() == limit );
+		for(auto&& value : values)
+			assert( wrapper(value) == wrap(value, limit) );
+
+		std::vector<Number> wrapped;
+		wrapper(values, std::back_inserter(wrapped));
+		assert( wrapped.size() == values.size() );
+		assert( std::equal(wrapped.begin(), wrapped.end(), values.begin(),
+			[&](auto a, auto b) { return a == wrap(b, limit); }) );
+	}
+}
+
+void Wrapper()
+{
+	check_wrapper<unsigned>({1, 2, 3, 7, 10, 1u << 31, 0xffff'ffff},
+		{0, 1, 2, 9, 10, 11, 12345, 1u << 31, 0xffff'fffe, 0xffff'ffff});
+	check_wrapper<int>({1, 2, 3, 7, 10, -10, 1 << 30},
+		{0, 1, -1, -9, -10, -11, -20, -21, 12345, -12345, 1 << 29, -(1 << 29)});
+	check_wrapper<short>({1, 3, 10, -10, 1000},
+		{0, 1, -1, -9, -10, -11, -20, -21, 12345, -12345, 32767, -32768});
+	check_wrapper<unsigned short>({1, 3, 10, 65535},
+		{0, 1, 9, 10, 11, 65534, 65535});
+	check_wrapper<unsigned char>({1, 3, 10, 255}, {0, 1, 9, 10, 11, 254, 255});
+	check_wrapper<unsigned long long>({1, 3, 10, 1ull << 63, ~0ull},
+		{0, 1, 9, 10, 11, ~0ull, ~0ull - 9, 1ull << 63, 1234567890123456789ull});
+	check_wrapper<long long>({1, 3, 10, -10, 1ll << 62},
+		{0, 1, -1, -9, -10, -11, -21, 1234567890123456789ll, -1234567890123456789ll});
+	check_wrapper<double>({1, 0.5, 10}, {0, -0.25, 0.25, 9.75, -9.75, 100});
+
+	std::vector<unsigned> values(1000);
+	std::iota(values.begin(), values.end(), 0u);
+	for(unsigned limit = 1; limit < 1000; ++limit)
+	{
+		const auto wrapper = support::wrapper(limit);
+		for(auto&& value : values)
+			assert( wrapper(value * 4'294'967u) == wrap(value * 4'294'967u, limit) );
+	}
+
+	// diagonal distribution does this, size_t underflow and back
+	const auto dimensions = support::wrapper<std::size_t>(3);
+	assert( dimensions(std::size_t(0) - 1) == 2 );
+	assert( dimensions(std::size_t(0) - 2) == 1 );
+	assert( dimensions(3) == 0 );
+}
+
+void Way()
+{
+	const std::vector<int> from{0, 10, -10, 100, -7, 3};
+	const std::vector<int> to{10, 0, 10, -100, 7, 3};
+	const auto quarter = rational{1, 4};
+	const auto third = rational(1, meta_constant<int,3>{});
+
+	std::vector<int> result;
+	way(from, to, quarter, std::back_inserter(result));
+	assert(( result == std::vector<int>{2, 8, -5, 50, -4, 3} ));
+	for(std::size_t i = 0; i < from.size(); ++i)
+		assert( result[i] == way(from[i], to[i], quarter) );
+
+	result.clear();
+	wayback(from, to, quarter, std::back_inserter(result));
+	assert(( result == std::vector<int>{2, 8, -5, 50, -4, 3} ));
+
+	result.clear();
+	way(from, to, third, std::back_inserter(result));
+	for(std::size_t i = 0; i < from.size(); ++i)
+		assert( result[i] == way(from[i], to[i], third) );
+
+	result.clear();
+	way(from, to, rational{-3, -2}, std::back_inserter(result));
+	assert(( result == std::vector<int>{15, -5, 20, -200, 14, 3} ));
+
+	result.clear();
+	way(from, to, 2, std::back_inserter(result));
+	assert(( result == std::vector<int>{20, -10, 30, -300, 21, 3} ));
+
+	result.clear();
+	way(from, to, std::array{0, 1, 2, 3, 4, 5}, std::back_inserter(result));
+	assert(( result == std::vector<int>{0, 0, 30, -500, 49, 3} ));
+
+	result.clear();
+	halfway(from, to, std::back_inserter(result));
+	assert(( result == std::vector<int>{5, 5, 0, 0, 0, 3} ));
+	result.clear();
+	halfwayback(from, to, std::back_inserter(result));
+	assert(( result == std::vector<int>{5, 5, 0, 0, 0, 3} ));
+
+	const array<float, 4> ffrom{0.f, 1.f, -2.f, 100.f};
+	const array<float, 4> fto{1.f, 0.f, 2.f, -100.f};
+	const array<float, 4> expected{0.25f, 0.75f, -1.f, 50.f};
+	assert( way(ffrom, fto, 0.25f) == expected );
+	assert( wayback(ffrom, fto, 0.25f) == expected );
+	assert( way(ffrom, fto, rational{1.f, 4.f}) == expected );
+	assert( way(ffrom, fto, rational{1, 4}) == expected );
+	assert(( way(ffrom, fto, array<float, 4>{0.f, 1.f, 0.5f, 0.25f})
+		== array<float, 4>{0.f, 0.f, 0.f, 50.f} ));
+	assert(( halfway(ffrom, fto) == array<float, 4>{0.5f, 0.5f, 0.f, 0.f} ));
+	assert(( halfwayback(ffrom, fto) == array<float, 4>{0.5f, 0.5f, 0.f, 0.f} ));
+
+	static_assert( way(10, 20, rational{1,2}) == 15 );
+	static_assert( wayback(10, 20, rational{1,2}) == 15 );
+	static_assert( way(0.0, 1.0, 0.5) == 0.5 );
+
+	static_assert( way(0.0, 1.0, rational{1,2}) == 0.5 );
+	static_assert( wayback(0.0, 1.0, rational{1,2}) == 0.5 );
+	assert( way(ffrom[0], fto[0], quarter) == 0.25f );
+	assert( way(ffrom[2], fto[2], third) == ffrom[2] + 4.f/3.f );
+	assert( wayback(ffrom[3], fto[3], quarter) == 50.f );
+
+	// wider than the ratio, the difference doesn't fit in an int
+	const long long big = 1ll << 40;
+	assert( way(-big, big, quarter) == -big/2 );
+	assert( wayback(-big, big, quarter) == -big/2 );
+	const std::vector<long long> lfrom{-big, big};
+	const std::vector<long long> lto{big, -big};
+	std::vector<long long> lresult;
+	way(lfrom, lto, quarter, std::back_inserter(lresult));
+	assert(( lresult == std::vector<long long>{-big/2, big/2} ));
+}
+
 constexpr bool Constexprness()
 {
 	range<int> v{};
@@ -195,6 +321,9 @@ constexpr bool Constexprness()
 	prev_number(v.bounds);
 	variance(v.bounds);
 	void(wrap(1,1));
+	void(support::wrapper(3)(-1));
+	void(way(v.bounds, v.bounds, 1, v.bounds.begin()));
+	void(way(v.bounds, v.bounds, rational{1,2}));
 	void(midpoint(1,1));
 	void(average(1,1));
 	return true;
@@ -351,6 +480,8 @@ int main()
 	Search();
 	Split();
 	SetDifference();
+	Wrapper();
+	Way();
 	static_assert(Constexprness());
 	return 0;
 }
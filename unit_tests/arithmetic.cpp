@@ -1,6 +1,11 @@
 #include <cassert>
 #include <limits>
+#include <cstdint>
+#include <vector>
 #include "simple/support/arithmetic.hpp"
+#include "simple/support/overflow.hpp"
+#include "simple/support/array.hpp"
+#include "simple/support/array_operators.hpp"
 
 using namespace simple::support;
 using Largest = unsigned long long;
@@ -107,8 +112,153 @@ void Overflow()
 
 }
 
+// exhaustive for small types, against int arithmetic
+template <typename Small>
+void checkOverflowPolicies()
+{
+	using limits = std::numeric_limits<Small>;
+	auto clamp = [](int x) { return Small(x < limits::min() ? limits::min() : x > limits::max() ? limits::max() : x); };
+	auto wrap = [](int x) { return Small(x); };
+	auto fits = [](int x) { return x >= limits::min() && x <= limits::max(); };
+
+	std::vector<Small> ones, others, sums, differences;
+	for(int a = limits::min(); a <= limits::max(); ++a)
+	for(int b = limits::min(); b <= limits::max(); ++b)
+	{
+		const auto x = Small(a), y = Small(b);
+		ones.push_back(x);
+		others.push_back(y);
+
+		assert( (saturating<Small>(x) + y).value() == clamp(a + b) );
+		assert( (saturating<Small>(x) - y).value() == clamp(a - b) );
+		assert( (saturating<Small>(x) * y).value() == clamp(a * b) );
+		assert( (wrapping<Small>(x) + y).value() == wrap(a + b) );
+		assert( (wrapping<Small>(x) - y).value() == wrap(a - b) );
+		assert( (wrapping<Small>(x) * y).value() == wrap(a * b) );
+
+		const auto sum = checked<Small>(x) + y;
+		assert( sum.valid() == fits(a + b) );
+		assert( sum.value_or(0) == (fits(a + b) ? a + b : 0) );
+		assert( (checked<Small>(x) - y).valid() == fits(a - b) );
+		assert( (checked<Small>(x) * y).valid() == fits(a * b) );
+		assert( (checked<Small>(x) * y).value_or(0) == (fits(a * b) ? a * b : 0) );
+
+		if(b != 0)
+		{
+			assert( (saturating<Small>(x) / y).value() == clamp(a / b) );
+			assert( (wrapping<Small>(x) / y).value() == wrap(a / b) );
+			assert( (wrapping<Small>(x) % y).value() == wrap(a % b) );
+			assert( (checked<Small>(x) / y).valid() == fits(a / b) );
+			assert( (checked<Small>(x) % y).value_or(0) == a % b );
+		}
+		else
+			assert( !(checked<Small>(x) / y).valid() );
+	}
+
+	for(int a = limits::min(); a <= limits::max(); ++a)
+	{
+		assert( (-saturating<Small>(Small(a))).value() == clamp(-a) );
+		assert( (-wrapping<Small>(Small(a))).value() == wrap(-a) );
+		assert( (-checked<Small>(Small(a))).valid() == fits(-a) );
+	}
+
+	sums.resize(ones.size());
+	differences.resize(ones.size());
+	assert( saturating_add(ones, others, sums.begin()) == sums.end() );
+	saturating_sub(ones.begin(), ones.end(), others.begin(), differences.begin());
+	for(std::size_t i = 0; i < ones.size(); ++i)
+	{
+		assert( sums[i] == clamp(int(ones[i]) + int(others[i])) );
+		assert( differences[i] == clamp(int(ones[i]) - int(others[i])) );
+	}
+}
+
+// batch version should agree with the wrapper on bigger types
+template <typename Int>
+void checkBatchSaturation()
+{
+	using limits = std::numeric_limits<Int>;
+	const std::vector<Int> values{limits::min(), Int(limits::min() + 1), Int(limits::min() / 2), Int(-1), 0, 1, 2,
+		Int(limits::max() / 2), Int(limits::max() - 1), limits::max()};
+	std::vector<Int> ones, others;
+	for(auto a : values)
+		for(auto b : values)
+		{
+			ones.push_back(a);
+			others.push_back(b);
+		}
+	std::vector<Int> sums(ones.size()), differences(ones.size());
+	saturating_add(ones, others, sums.begin());
+	saturating_sub(ones, others, differences.begin());
+	for(std::size_t i = 0; i < ones.size(); ++i)
+	{
+		assert( sums[i] == (saturating<Int>(ones[i]) + others[i]).value() );
+		assert( differences[i] == (saturating<Int>(ones[i]) - others[i]).value() );
+	}
+
+	assert( !(checked<Int>(limits::max()) + Int(1)).valid() );
+	assert( (checked<Int>(limits::max()) + Int(1) - Int(1)).value_or(0) == 0 );
+	assert( (checked<Int>(limits::max() / 2) * Int(2)).valid() );
+	assert( !(checked<Int>(limits::max() / 2) * Int(3)).valid() );
+	assert( (wrapping<Int>(limits::max()) + Int(1)).value() == limits::min() );
+	assert( (saturating<Int>(limits::max()) * Int(2)).value() == limits::max() );
+	assert( (saturating<Int>(limits::min()) - Int(1)).value() == limits::min() );
+}
+
+template <typename T>
+struct vec3 : simple::support::array<T, 3> {};
+
+template <typename T>
+struct simple::support::define_array_operators<vec3<T>> :
+	simple::support::trivial_array_accessor<vec3<T>, 3>
+{
+	constexpr static auto enabled_operators = array_operator::binary | array_operator::in_place;
+	constexpr static auto enabled_right_element_operators = array_operator::binary | array_operator::in_place;
+	constexpr static auto enabled_left_element_operators = array_operator::none;
+};
+
+constexpr bool ArrayOperators()
+{
+	using sat = saturating<std::int8_t>;
+	vec3<sat> a{{sat{100}, sat{-100}, sat{1}}};
+	vec3<sat> b{{sat{100}, sat{-100}, sat{2}}};
+	auto sum = a + b;
+	auto product = a * sat{2};
+	a += b;
+	a -= vec3<sat>{{sat{27}, sat{-28}, sat{0}}};
+
+	using chk = checked<std::uint16_t>;
+	vec3<chk> c{{chk{60000}, chk{1}, chk{2}}};
+	c *= chk{2};
+
+	return sum == vec3<sat>{{sat{127}, sat{-128}, sat{3}}} &&
+		product == vec3<sat>{{sat{127}, sat{-128}, sat{2}}} &&
+		a == vec3<sat>{{sat{100}, sat{-100}, sat{3}}} &&
+		!c[0].valid() && c[1].valid() && c[2].value() == 4;
+}
+
+void OverflowPolicies()
+{
+	checkOverflowPolicies<std::int8_t>();
+	checkOverflowPolicies<std::uint8_t>();
+	checkBatchSaturation<short>();
+	checkBatchSaturation<unsigned short>();
+	checkBatchSaturation<int>();
+	checkBatchSaturation<unsigned>();
+	checkBatchSaturation<long long>();
+	checkBatchSaturation<unsigned long long>();
+	static_assert(ArrayOperators());
+
+	static_assert( (saturating<int>(std::numeric_limits<int>::max()) + 1).value() == std::numeric_limits<int>::max() );
+	static_assert( (saturating<unsigned>(1) - 2u).value() == 0 );
+	static_assert( (wrapping<int>(std::numeric_limits<int>::min()) / -1).value() == std::numeric_limits<int>::min() );
+	static_assert( !(checked<int>(std::numeric_limits<int>::min()) / -1).valid() );
+	static_assert( saturating<int>(3) < 4 && wrapping<int>(3) == 3 && checked<int>(2) != 3 );
+}
+
 int main()
 {
 	Overflow();
+	OverflowPolicies();
 	return 0;
 }
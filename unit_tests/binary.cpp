@@ -1,5 +1,9 @@
 #include "simple/support/bits.hpp"
+#include <cassert>
 #include <climits>
+#include <cstdint>
+#include <array>
+#include <limits>
 
 using namespace simple::support;
 
@@ -12,6 +16,180 @@ constexpr void powers_of_two()
 template <>
 constexpr void powers_of_two<0>(){}
 
+template <typename Unsigned>
+constexpr bool check_counts(Unsigned x)
+{
+	int ones = 0;
+	int trailing = -1;
+	for(int i = 0; i < std::numeric_limits<Unsigned>::digits; ++i)
+	{
+		if((x >> i) & 1)
+		{
+			++ones;
+			if(trailing == -1)
+				trailing = i;
+		}
+	}
+	return count_ones(x) == ones && (x == 0 || count_trailing_zeros(x) == trailing);
+}
+
+constexpr bool CountsAgainstNaive()
+{
+	std::uint64_t state = 0x9e37'79b9'7f4a'7c15;
+	for(int i = 0; i < 10'000; ++i)
+	{
+		state ^= state << 13; state ^= state >> 7; state ^= state << 17;
+		// sparse ones too
+		const std::uint64_t x = state & (state >> (i % 64));
+		if(!check_counts(x) || !check_counts(std::uint32_t(x)) ||
+			!check_counts(std::uint16_t(x)) || !check_counts(std::uint8_t(x)))
+			return false;
+	}
+	for(int i = 0; i < 64; ++i)
+		if(!check_counts(std::uint64_t{1} << i) || !check_counts(~std::uint64_t{} << i))
+			return false;
+	return true;
+}
+
+constexpr bool LeadingZeros()
+{
+	static_assert(count_leading_zeros(1u) == sizeof(unsigned) * CHAR_BIT - 1);
+	static_assert(count_leading_zeros(-1) == 0);
+	static_assert(count_leading_zeros(std::uint8_t{1}) == 7);
+	static_assert(count_leading_zeros(std::uint16_t{0xff}) == 8);
+	static_assert(count_leading_zeros(std::int8_t{-1}) == 0);
+	static_assert(count_leading_zeros(std::uint64_t{1} << 40) == 23);
+	static_assert(count_leading_zeros(0x1000'0101'1010'0000ULL) == 3);
+
+	static_assert(bit_width(0) == 0);
+	static_assert(bit_width(1) == 1);
+	static_assert(bit_width(0b1010u) == 4);
+	static_assert(bit_width(std::uint8_t{255}) == 8);
+	static_assert(bit_width(~std::uint64_t{}) == 64);
+
+	static_assert(next_power_of_two(0u) == 1);
+	static_assert(next_power_of_two(1u) == 1);
+	static_assert(next_power_of_two(2u) == 2);
+	static_assert(next_power_of_two(3u) == 4);
+	static_assert(next_power_of_two(1000u) == 1024);
+	static_assert(next_power_of_two(std::uint8_t{128}) == 128);
+	static_assert(next_power_of_two((std::uint64_t{1} << 62) + 1) == std::uint64_t{1} << 63);
+
+	for(unsigned i = 1; i < 100'000; ++i)
+	{
+		auto p = next_power_of_two(i);
+		if(count_ones(p) != 1 || p < i || p/2 >= i)
+			return false;
+	}
+	return true;
+}
+
+constexpr bool RotateAndSwap()
+{
+	static_assert(rotate_left(std::uint8_t{0b1000'0001}, 1) == 0b0000'0011);
+	static_assert(rotate_right(std::uint8_t{0b1000'0001}, 1) == 0b1100'0000);
+	static_assert(rotate_left(std::uint32_t{0x1234'5678}, 8) == 0x3456'7812);
+	static_assert(rotate_right(std::uint32_t{0x1234'5678}, 8) == 0x7812'3456);
+	static_assert(rotate_left(std::uint32_t{0x1234'5678}, 0) == 0x1234'5678);
+	static_assert(rotate_left(std::uint32_t{0x1234'5678}, 32) == 0x1234'5678);
+	static_assert(rotate_left(std::uint32_t{0x1234'5678}, -8) == 0x7812'3456);
+	static_assert(rotate_right(std::uint64_t{1}, 1) == std::uint64_t{1} << 63);
+
+	static_assert(byteswap(std::uint8_t{0x12}) == 0x12);
+	static_assert(byteswap(std::uint16_t{0x1234}) == 0x3412);
+	static_assert(byteswap(std::uint32_t{0x1234'5678}) == 0x7856'3412);
+	static_assert(byteswap(std::uint64_t{0x0102'0304'0506'0708}) == 0x0807'0605'0403'0201);
+	static_assert(byteswap(std::int32_t{-2}) == std::int32_t(0xfeff'ffff));
+
+	for(std::uint32_t x = 0; x < 100'000; x += 7)
+		if(byteswap(byteswap(x)) != x || rotate_right(rotate_left(x, x % 40), x % 40) != x)
+			return false;
+	return true;
+}
+
+constexpr bool DepositExtract()
+{
+	static_assert(deposit_bits(0b101u, 0b1110'0000u) == 0b1010'0000u);
+	static_assert(extract_bits(0b1010'0000u, 0b1110'0000u) == 0b101u);
+	static_assert(deposit_bits(~0u, 0b1001'0110u) == 0b1001'0110u);
+	static_assert(extract_bits(0xffff'0000u, 0xff00'ff00u) == 0xff00u);
+	static_assert(deposit_bits(std::uint64_t{0b11}, std::uint64_t{0b101} << 60) == std::uint64_t{0b101} << 60);
+	static_assert(extract_bits(std::uint8_t{0b1100'0011}, std::uint8_t{0b1000'0001}) == 0b11);
+
+	static_assert(nth_set_bit(0b1011'0100u, 0) == 2);
+	static_assert(nth_set_bit(0b1011'0100u, 3) == 7);
+	static_assert(nth_set_bit(~std::uint64_t{}, 63) == 63);
+
+	std::uint32_t mask = 0x5a5a'0ff1;
+	for(std::uint32_t x = 0; x < 10'000; ++x)
+	{
+		if(extract_bits(deposit_bits(x, mask), mask) != (x & ((1u << count_ones(mask)) - 1)))
+			return false;
+		if(deposit_bits(extract_bits(x, mask), mask) != (x & mask))
+			return false;
+	}
+	return true;
+}
+
+constexpr bool BulkOperations()
+{
+	std::array<std::uint64_t, 37> a{};
+	std::array<std::uint64_t, 37> b{};
+	if(count_ones(a) != 0 || find_first_set(a) != a.size() * 64)
+		return false;
+
+	std::size_t a_ones = 0, b_ones = 0, common = 0, either = 0, different = 0;
+	std::uint64_t state = 0x1234'5678'9abc'def1;
+	for(std::size_t i = 0; i < a.size(); ++i)
+	{
+		// xorshift for some noise
+		state ^= state << 13; state ^= state >> 7; state ^= state << 17;
+		a[i] = state;
+		state ^= state << 13; state ^= state >> 7; state ^= state << 17;
+		b[i] = state & (i % 3 ? state : 0);
+		a_ones += count_ones(a[i]);
+		b_ones += count_ones(b[i]);
+		common += count_ones(a[i] & b[i]);
+		either += count_ones(a[i] | b[i]);
+		different += count_ones(a[i] ^ b[i]);
+	}
+	if(count_ones(a) != a_ones || count_ones(b.begin(), b.end()) != b_ones)
+		return false;
+	if(count_ones(a.begin() + 3, a.begin() + 4) != std::size_t(count_ones(a[3])))
+		return false;
+	if(count_ones_and(a.begin(), a.end(), b.begin()) != common)
+		return false;
+	if(count_ones_or(a.begin(), a.end(), b.begin()) != either)
+		return false;
+	if(count_ones_xor(a.begin(), a.end(), b.begin()) != different)
+		return false;
+
+	std::array<std::uint8_t, 5> bytes{0, 0, 0b1000, 1, 0};
+	if(find_first_set(bytes) != 2 * 8 + 3)
+		return false;
+	if(find_first_set(bytes.begin() + 3, bytes.end()) != 0)
+		return false;
+	if(count_ones(bytes) != 2)
+		return false;
+
+	std::size_t expected[] = {2 * 8 + 3, 3 * 8};
+	std::size_t n = 0;
+	for(auto position : set_bits(bytes))
+		if(n >= 2 || position != expected[n++])
+			return false;
+	if(n != 2)
+		return false;
+
+	n = 0;
+	for(auto position : set_bits(a))
+	{
+		if(((a[position / 64] >> (position % 64)) & 1) == 0)
+			return false;
+		++n;
+	}
+	return n == a_ones;
+}
+
 int main()
 {
 	static_assert(count_ones(0) == 0);
@@ -24,5 +202,16 @@ int main()
 	static_assert(count_trailing_zeros(0x1000'0101'1010'0000LL) == 5*4);
 	static_assert(count_trailing_zeros(1 << 0) == 0);
 	powers_of_two<sizeof(int) * CHAR_BIT - 1>();
+	static_assert(CountsAgainstNaive());
+	static_assert(LeadingZeros());
+	static_assert(RotateAndSwap());
+	static_assert(DepositExtract());
+	static_assert(BulkOperations());
+	// at runtime intrinsics might kick in
+	assert(CountsAgainstNaive());
+	assert(LeadingZeros());
+	assert(RotateAndSwap());
+	assert(DepositExtract());
+	assert(BulkOperations());
 	return 0;
 }
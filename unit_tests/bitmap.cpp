@@ -0,0 +1,112 @@
+#include "simple/support/bitmap.hpp"
+#include "simple/support/random.hpp"
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+using namespace simple::support;
+
+void Basics()
+{
+	bitmap bits(1000);
+	assert( bits.size() == 1000 );
+	assert( bits.count() == 0 );
+	assert( reinterpret_cast<std::uintptr_t>(bits.data()) % 64 == 0 );
+
+	bits.set(0);
+	bits.set(63);
+	bits.set(64);
+	bits.set(999);
+	assert( bits[0] && bits[63] && bits[64] && bits[999] );
+	assert( !bits[1] && !bits[998] );
+	assert( bits.count() == 4 );
+	bits.flip(63);
+	bits.reset(0);
+	bits.set(500, true);
+	assert( bits.count() == 3 );
+
+	std::vector<std::size_t> positions;
+	for(auto position : bits.set_bits())
+		positions.push_back(position);
+	assert(( positions == std::vector<std::size_t>{64, 500, 999} ));
+
+	// growing with ones and shrinking keeps the tail clear
+	bits.resize(1010, true);
+	assert( bits.count() == 13 );
+	bits.resize(1001);
+	assert( bits.count() == 4 );
+	bits.resize(1010);
+	assert( bits.count() == 4 );
+
+	bitmap ones(130, true);
+	assert( ones.count() == 130 );
+	bitmap other(130);
+	other.set(3);
+	other.set(129);
+	ones ^= other;
+	assert( ones.count() == 128 && !ones[3] && !ones[129] );
+	ones |= other;
+	assert( ones == bitmap(130, true) );
+	ones &= other;
+	assert( ones == other );
+
+	bitmap nothing;
+	nothing.update_index();
+	assert( nothing.rank(0) == 0 );
+	assert( nothing.select(0) == 0 );
+	assert( nothing.set_bits().begin() == nothing.set_bits().end() );
+}
+
+void RankSelect()
+{
+	auto seed = std::random_device{}();
+	std::cout << "Bitmap rank/select test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+
+	for(double density : {0.001, 0.1, 0.5, 0.99})
+	{
+		std::bernoulli_distribution bit{density};
+		const std::size_t size = 100'000 + random() % 1000;
+		bitmap bits(size);
+		std::vector<std::size_t> positions;
+		for(std::size_t i = 0; i < size; ++i)
+		{
+			if(bit(random))
+			{
+				bits.set(i);
+				positions.push_back(i);
+			}
+		}
+		assert( !bits.index_valid() );
+		bits.update_index();
+		assert( bits.index_valid() );
+		assert( bits.count() == positions.size() );
+
+		std::size_t rank = 0;
+		for(std::size_t i = 0; i <= size; ++i)
+		{
+			assert( bits.rank(i) == rank );
+			if(i < size && bits[i])
+				++rank;
+		}
+
+		for(std::size_t n = 0; n < positions.size(); ++n)
+			assert( bits.select(n) == positions[n] );
+		assert( bits.select(positions.size()) == size );
+
+		std::size_t n = 0;
+		for(auto position : bits.set_bits())
+			assert( position == positions[n++] );
+		assert( n == positions.size() );
+	}
+}
+
+int main()
+{
+	Basics();
+	RankSelect();
+	return 0;
+}
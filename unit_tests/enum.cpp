@@ -1,6 +1,10 @@
 #include <cassert>
 #include <string_view>
+#include <iostream>
+#include <iomanip>
+#include <random>
 #include "simple/support/enum.hpp"
+#include "simple/support/random.hpp"
 
 using namespace simple::support;
 
@@ -32,8 +36,71 @@ template <> digit::guts::map_type digit::guts::map
 	{"4", "four"},
 }};
 
+// not names, searched linearly
+using digit_value = mapped_enum
+<
+	digits,
+	digits::invalid,
+	1,
+	int
+>;
+
+template <> digit_value::guts::map_type digit_value::guts::map
+{{
+	{0}, {1}, {2}, {3}, {4}
+}};
+
+void PerfectHash()
+{
+	auto seed = std::random_device{}();
+	std::cout << "Perfect hash test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+
+	for(int i = 0; i < 100; ++i)
+	{
+		// every other time short strings from a small alphabet, so plenty of duplicates
+		std::vector<std::string> strings(random() % 300);
+		for(auto& string : strings)
+		{
+			string.resize(random() % (i % 2 ? 4 : 9));
+			for(auto& c : string)
+				c = 'a' + random() % (i % 2 ? 3 : 26);
+		}
+		const enum_details::perfect_hash hash({strings.begin(), strings.end()});
+		for(std::size_t j = 0; j < strings.size(); ++j)
+		{
+			const auto first = std::find(strings.begin(), strings.end(), strings[j]) - strings.begin();
+			assert( hash.find(strings[j]) == std::size_t(first) );
+		}
+		if(std::find(strings.begin(), strings.end(), "abcd") == strings.end())
+			assert( hash.find("abcd") == enum_details::perfect_hash::npos );
+		if(std::find(strings.begin(), strings.end(), "") == strings.end())
+			assert( hash.find("") == enum_details::perfect_hash::npos );
+
+		// the hash has its own copy
+		const auto originals = strings;
+		for(auto& string : strings)
+			string.assign(string.size(), 'z');
+		for(std::size_t j = 0; j < originals.size(); ++j)
+		{
+			const auto first = std::find(originals.begin(), originals.end(), originals[j]) - originals.begin();
+			assert( hash.find(originals[j]) == std::size_t(first) );
+		}
+	}
+}
+
 int main()
 {
+	PerfectHash();
+
+	assert( digit::guts::from(std::string_view("zero1").substr(0,4)) == digits::zero );
+	assert( digit::guts::from(std::string("four")) == digits::four );
+	assert( digit::guts::from("fou") == digits::invalid );
+	assert( digit::guts::from("") == digits::invalid );
+	assert( digit_value::guts::from(3) == digits::three );
+	assert( digit_value::guts::from(5) == digits::invalid );
+	assert( digit_value(3) == digits::three );
+
 	assert( digit("one") == digit("1") );
 	assert( digit("one") == digits::one );
 	switch(digit("two"))
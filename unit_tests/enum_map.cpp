@@ -0,0 +1,137 @@
+#include <cassert>
+#include <string_view>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <set>
+#include <vector>
+#include "simple/support/enum_map.hpp"
+#include "simple/support/random.hpp"
+
+using namespace simple::support;
+
+enum class color
+{
+	red,
+	green,
+	blue,
+
+	invalid
+};
+
+using mapped_color = mapped_enum<color, color::invalid, 1, std::string_view>;
+
+template <> mapped_color::guts::map_type mapped_color::guts::map
+{{
+	{"red"}, {"green"}, {"blue"}
+}};
+
+static_assert(enum_size_v<mapped_color> == 3);
+
+enum class wide { first, last = 199 };
+
+constexpr bool Constexpr()
+{
+	constexpr enum_map<mapped_color, int> rgb{{0xff0000, 0x00ff00, 0x0000ff}};
+	static_assert(rgb[color::green] == 0x00ff00);
+	static_assert(rgb.size() == 3);
+	static_assert(rgb.key(2) == color::blue);
+
+	constexpr enum_set<mapped_color> warm{color::red};
+	static_assert(warm.contains(color::red));
+	static_assert(!warm.contains(color::blue));
+	static_assert(warm.size() == 1);
+	static_assert((~warm).size() == 2);
+	static_assert(~warm == enum_set<mapped_color>{color::green, color::blue});
+	static_assert((warm | ~warm) == enum_set<mapped_color>::all());
+	static_assert((warm & ~warm).empty());
+	static_assert(*enum_set<mapped_color>{color::blue}.begin() == color::blue);
+
+	static_assert(enum_set<wide, 200>::all().size() == 200);
+	static_assert(enum_set<wide, 0>{}.begin() == enum_set<wide, 0>{}.end());
+	return true;
+}
+
+void Map()
+{
+	enum_map<mapped_color, std::string_view> names{};
+	for(std::size_t i = 0; i < names.size(); ++i)
+		names[names.key(i)] = mapped_color::guts::to(names.key(i));
+	assert( names[color::green] == "green" );
+	assert( names.at(color::blue) == "blue" );
+
+	bool thrown = false;
+	try { (void)names.at(color::invalid); }
+	catch(const std::out_of_range&) { thrown = true; }
+	assert( thrown );
+
+	names.fill("gray");
+	for(auto&& name : names)
+		assert( name == "gray" );
+}
+
+void Set()
+{
+	auto seed = std::random_device{}();
+	std::cout << "Enum set test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+
+	using set = enum_set<wide, 200>;
+	for(int i = 0; i < 1000; ++i)
+	{
+		set one, other;
+		std::set<int> expected_one, expected_other;
+		const int count = random() % 100;
+		for(int j = 0; j < count; ++j)
+		{
+			const int value = random() % (i % 2 ? 200 : 70);
+			one.insert(wide(value));
+			expected_one.insert(value);
+			const int other_value = random() % 200;
+			other.insert(wide(other_value));
+			expected_other.insert(other_value);
+		}
+		if(!expected_one.empty() && random() % 2)
+		{
+			const int value = *expected_one.begin();
+			one.erase(wide(value));
+			expected_one.erase(value);
+		}
+
+		auto as_vector = [](const set& s)
+		{
+			std::vector<int> result;
+			for(auto value : s)
+				result.push_back(int(value));
+			return result;
+		};
+		auto expected = [](auto op, const std::set<int>& a, const std::set<int>& b)
+		{
+			std::vector<int> result;
+			for(int value = 0; value < 200; ++value)
+				if(op(a.count(value) != 0, b.count(value) != 0))
+					result.push_back(value);
+			return result;
+		};
+
+		assert( one.size() == expected_one.size() );
+		assert( one.empty() == expected_one.empty() );
+		assert( as_vector(one) == std::vector<int>(expected_one.begin(), expected_one.end()) );
+		for(int value = 0; value < 200; ++value)
+			assert( one.contains(wide(value)) == (expected_one.count(value) != 0) );
+		assert( as_vector(one | other) == expected([](bool a, bool b) { return a || b; }, expected_one, expected_other) );
+		assert( as_vector(one & other) == expected([](bool a, bool b) { return a && b; }, expected_one, expected_other) );
+		assert( as_vector(one ^ other) == expected([](bool a, bool b) { return a != b; }, expected_one, expected_other) );
+		assert( as_vector(one - other) == expected([](bool a, bool b) { return a && !b; }, expected_one, expected_other) );
+		assert( as_vector(~one) == expected([](bool a, bool) { return !a; }, expected_one, expected_other) );
+		assert( (one == other) == (expected_one == expected_other) );
+	}
+}
+
+int main()
+{
+	static_assert(Constexpr());
+	Map();
+	Set();
+	return 0;
+}
@@ -0,0 +1,83 @@
+#include "simple/support/fixed_point.hpp"
+#include <cassert>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+using namespace simple::support;
+
+using q15 = fixed_point<std::int16_t, 15>;
+using q16 = fixed_point<std::int32_t, 16>;
+using q32 = fixed_point<std::int64_t, 32>;
+using uq8 = fixed_point<std::uint8_t, 4>;
+
+constexpr bool Constexpr()
+{
+	static_assert( q16(1.5).raw() == 3 << 15 );
+	static_assert( q16(3).raw() == 3 << 16 );
+	static_assert( double(q16(1.5) * q16(2.25)) == 3.375 );
+	static_assert( double(q16(1.5) / q16(-0.5)) == -3 );
+	static_assert( q16(-1.5).to_integer() == -2 );
+	static_assert( q16(-1.5).to_integer<rounding::toward_zero>() == -1 );
+	static_assert( q16(-1.5).to_integer<rounding::nearest>() == -2 );
+	static_assert( q16(rational(3, meta_constant<int,4>{})) == q16(0.75) );
+	static_assert( q16(rational(1, meta_constant<int,3>{})).raw() == 21845 );
+	static_assert( q16(0.75).ratio() == rational(3 << 14, q16::denominator{}) );
+
+	// saturation
+	static_assert( q15(1.0) == q15::from_raw(32767) );
+	static_assert( q15(-1.0) == q15::from_raw(-32768) );
+	static_assert( q15(-1.0) * q15(-1.0) == q15::from_raw(32767) );
+	static_assert( -q15(-1.0) == q15::from_raw(32767) );
+	static_assert( q15(0.75) + q15(0.75) == q15::from_raw(32767) );
+	static_assert( q15(-0.75) - q15(0.75) == q15::from_raw(-32768) );
+	static_assert( q16(40000) == q16::from_raw(std::numeric_limits<std::int32_t>::max()) );
+	static_assert( q16(-40000) == q16::from_raw(std::numeric_limits<std::int32_t>::min()) );
+	static_assert( q16(1e10) == q16::from_raw(std::numeric_limits<std::int32_t>::max()) );
+	static_assert( q16(1) / q16(0) == q16::from_raw(std::numeric_limits<std::int32_t>::max()) );
+	static_assert( q16(0) / q16(0) == q16(0) );
+	static_assert( uq8(-1) == uq8(0) );
+	static_assert( uq8(20) == uq8::from_raw(255) );
+	static_assert( uq8(2.5) * uq8(2) == uq8(5) );
+	static_assert( uq8(2) - uq8(3) == uq8(0) );
+
+	// wide intermediate for 64 bits
+	static_assert( q32(100000) * q32(100000) == q32::from_raw(std::numeric_limits<std::int64_t>::max()) );
+	static_assert( q32(1000.5) * q32(-1000.5) == q32(-1001000.25) );
+	static_assert( q32(1) / q32(3) == q32::from_raw(1431655765) );
+
+	q16 accumulator{};
+	for(int i = 0; i < 10; ++i)
+		accumulator += q16(0.5);
+	accumulator *= q16(0.5);
+	accumulator /= q16(2.5);
+	return accumulator == q16(1);
+}
+
+// against doubles, which are exact for these sizes
+void AgainstFloat()
+{
+	for(int a = -32768; a < 32768; a += 7)
+	for(int b = -32768; b < 32768; b += 13)
+	{
+		const auto x = q15::from_raw(std::int16_t(a)), y = q15::from_raw(std::int16_t(b));
+		auto expected = [](double value)
+		{
+			value = std::round(value * 32768);
+			return std::int16_t(std::clamp(value, -32768.0, 32767.0));
+		};
+		assert( (x * y).raw() == expected(double(x) * double(y)) );
+		assert( (x + y).raw() == expected(double(x) + double(y)) );
+		assert( (x - y).raw() == expected(double(x) - double(y)) );
+		if(b != 0)
+			assert( (x / y).raw() == expected(double(x) / double(y)) );
+	}
+}
+
+int main()
+{
+	static_assert(Constexpr());
+	AgainstFloat();
+	return 0;
+}
@@ -0,0 +1,113 @@
+#include "simple/support/format.hpp"
+#include "simple/support/misc.hpp"
+#include "simple/support/random.hpp"
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <limits>
+#include <string_view>
+#include <random>
+#include <iostream>
+#include <iomanip>
+
+using namespace simple::support;
+
+char buffer[256];
+
+template <typename T, typename... Args>
+std::string_view format(const T& value, Args... args)
+{
+	const auto [end, error] = format_to(buffer, buffer + sizeof(buffer), value, args...);
+	assert( std::errc{} == error );
+	return std::string_view(buffer, end - buffer);
+}
+
+void Known()
+{
+	assert( "0" == format(0) );
+	assert( "-128" == format(std::int8_t(-128)) );
+	assert( "18446744073709551615" == format(std::numeric_limits<std::uint64_t>::max()) );
+	assert( "0.1" == format(0.1) );
+	assert( "0.1" == format(0.1f) );
+	assert( "-1e+300" == format(-1e300) );
+	assert( "5e-324" == format(std::numeric_limits<double>::denorm_min()) );
+	assert( "inf" == format(std::numeric_limits<double>::infinity()) );
+
+	assert( "1/3" == format(rational(1,3)) );
+	assert( "-3/4" == format(rational(-3, meta_constant<int,4>{})) );
+
+	assert( "1 2.5 3" == format(array<double,3>{1, 2.5, 3}) );
+	assert( "1,2,3" == format(array<int,3>{1, 2, 3}, ',') );
+	assert( "" == format(array<int,0>{}) );
+
+	assert( "-1-2" == format(range<int>{-1, 2}) );
+	assert( "0.5~1.5" == format(range<double>{0.5, 1.5}, '~') );
+	assert( (range<double>{-0.1, 1e-10} == storn<double>(format(range<double>{-0.1, 1e-10}))) );
+	assert( "1:2" == format(range<int>{1, 3}, ':') );
+	assert( (range<int>{1, 3} == storn<int>(format(range<int>{1, 3}, ':'))) );
+	using q = rational<int, normalized<>>;
+	assert( "1/2:1/4" == format(range<q>{q(1,2), q(3,4)}, ':') );
+}
+
+void TooSmall()
+{
+	const range<int> value{12, 345};
+	const std::string_view expected = "12-345";
+	for(std::size_t size = 0; size < expected.size(); ++size)
+	{
+		const auto result = format_to(buffer, buffer + size, value);
+		assert( std::errc::value_too_large == result.ec );
+		assert( buffer + size == result.ptr );
+	}
+	assert( expected == format(value) );
+
+	for(std::size_t size = 0; size < 4; ++size)
+		assert( std::errc::value_too_large == format_to(buffer, buffer + size, rational(12,3)).ec );
+}
+
+template <typename Float, typename Bits>
+void check_round_trip(Bits bits)
+{
+	Float value;
+	std::memcpy(&value, &bits, sizeof(value));
+	if(value != value)
+		return;
+	const auto text = format(value);
+	Float parsed{};
+	assert( std::errc{} == strton(text, parsed).ec );
+	assert( std::memcmp(&parsed, &value, sizeof(value)) == 0 );
+
+	// one significant digit less doesn't round trip, so it's the shortest
+	char fewer[64];
+	int digits = 0;
+	for(char c : text.substr(0, text.find('e')))
+		digits += c >= '0' && c <= '9';
+	if(digits > 1 && text.find('e') != std::string_view::npos)
+	{
+		std::snprintf(fewer, sizeof(fewer), "%.*e", digits - 2, double(value));
+		assert( ston<Float>(fewer) != value );
+	}
+}
+
+void RoundTrip()
+{
+	auto seed = std::random_device{}();
+	std::cout << "Format round trip test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+
+	for(int i = 0; i < 100000; ++i)
+	{
+		const auto bits = random();
+		check_round_trip<double>(std::uint64_t(bits));
+		check_round_trip<float>(std::uint32_t(bits));
+	}
+}
+
+int main()
+{
+	Known();
+	TooSmall();
+	RoundTrip();
+	return 0;
+}
@@ -0,0 +1,113 @@
+#include "simple/support/heterogeneous_vector.hpp"
+#include <cassert>
+#include <string>
+#include <variant>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include "simple/support/random.hpp"
+
+using namespace simple::support;
+using namespace std::literals;
+
+struct position { float x, y; };
+struct velocity { float dx, dy; };
+
+using store = heterogeneous_vector<int, std::string, position, velocity>;
+static_assert(store::index_of<int> == 0);
+static_assert(store::index_of<velocity> == 3);
+static_assert(store::contains_type<position>);
+static_assert(!store::contains_type<double>);
+
+void Basic()
+{
+	store objects;
+	assert( objects.empty() );
+
+	objects.push_back(1);
+	objects.push_back("two"s);
+	objects.emplace_back<position>(position{3, 4});
+	objects.push_back(5);
+	objects.emplace_back<std::string>(3, 'x');
+	assert( objects.size() == 5 );
+	assert( objects.size<int>() == 2 );
+	assert( objects.size<velocity>() == 0 );
+	assert( (objects.get<std::string>() == std::vector{"two"s, "xxx"s}) );
+
+	int sum = 0;
+	objects.for_each<int>([&](int& x) { sum += x; x *= 10; });
+	assert( sum == 6 );
+	assert( (objects.get<int>() == std::vector{10, 50}) );
+
+	// types in order, each one contiguous
+	std::string visited;
+	objects.for_each([&](const auto& object)
+	{
+		using type = std::decay_t<decltype(object)>;
+		if constexpr (std::is_same_v<type, int>)
+			visited += std::to_string(object);
+		else if constexpr (std::is_same_v<type, std::string>)
+			visited += object;
+		else
+			visited += '.';
+	});
+	assert( visited == "1050twoxxx." );
+
+	objects.swap_erase<int>(0);
+	assert( (objects.get<int>() == std::vector{50}) );
+	objects.swap_erase<std::string>(1);
+	assert( (objects.get<std::string>() == std::vector{"two"s}) );
+
+	const store& view = objects;
+	std::size_t count = 0;
+	view.for_each([&](const auto&) { ++count; });
+	assert( count == view.size() );
+
+	objects.clear();
+	assert( objects.empty() );
+}
+
+// same results as a vector of variants, visited in a different order
+void AgainstVariant()
+{
+	auto seed = std::random_device{}();
+	std::cout << "Heterogeneous vector test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+
+	heterogeneous_vector<position, velocity> soa;
+	std::vector<std::variant<position, velocity>> aos;
+	for(int i = 0; i < 10000; ++i)
+	{
+		const float value = float(random() % 1000);
+		if(random() % 2)
+		{
+			soa.push_back(position{value, -value});
+			aos.push_back(position{value, -value});
+		}
+		else
+		{
+			soa.push_back(velocity{value, 2 * value});
+			aos.push_back(velocity{value, 2 * value});
+		}
+	}
+
+	float expected = 0, actual = 0;
+	for(auto&& object : aos)
+		if(auto p = std::get_if<position>(&object))
+			expected += p->x + p->y;
+	soa.for_each<position>([&](const position& p) { actual += p.x + p.y; });
+	assert( expected == actual );
+
+	std::size_t velocities = 0;
+	for(auto&& object : aos)
+		velocities += std::holds_alternative<velocity>(object);
+	assert( velocities == soa.size<velocity>() );
+	assert( aos.size() == soa.size() );
+}
+
+int main()
+{
+	Basic();
+	AgainstVariant();
+	return 0;
+}
@@ -2,7 +2,11 @@
 #include <iostream>
 
 #include "simple/support/int_literals.hpp"
+#include "simple/support/wide_int.hpp"
+#include "simple/support/fixed_point.hpp"
+#include "simple/support/rational.hpp"
 
+using namespace simple::support;
 using namespace simple::support::literals;
 
 int main()
@@ -12,5 +16,35 @@ int main()
 	static_assert(0xffff'ffff_u32 == uint32_t{0xffff'ffff});
 	static_assert(0x1'0000'0000_u64 == uint64_t{0x1'0000'0000});
 	static_assert(0xffff'ffff'ffff'ffff_u64 == uint64_t{0xffff'ffff'ffff'ffff});
+	static_assert(0b1010_u8 == 10);
+	static_assert(0XAb_u8 == 0xab);
+	static_assert(18446744073709551615_u64 == uint64_t(-1));
+
+	static_assert(340282366920938463463374607431768211455_u128 == ~wide_uint<128>{});
+	static_assert(0x1'0000'0000'0000'0000_u128 == wide_uint<128>(1) << 64);
+	static_assert(123456789012345678901234567890_u128 == 1234567890_u128 * 10000000000_u128 * 10000000000_u128 + 12345678901234567890_u128);
+	static_assert((0x8000'0000'0000'0000'0000'0000'0000'0000_u256 << 128) == wide_uint<256>(1) << 255);
+	static_assert(-170141183460469231731687303715884105727_i128 == std::numeric_limits<wide_int<128>>::min() + wide_int<128>(1));
+	static_assert(-1_i256 < 0_i256);
+
+	static_assert(1.5_q16 == fixed_point<int32_t, 16>(1.5));
+	static_assert((1.5_q16).raw() == 3 << 15);
+	static_assert((0.1_q16).raw() == 6554); // 6553.6 rounded
+	static_assert((-0.25_q8).raw() == -64);
+	static_assert((0.999969482421875_q15).raw() == 32767);
+	static_assert((3_q32).raw() == 3ll << 32);
+	static_assert((0x10_q16).raw() == 16 << 16);
+	static_assert(1'000.000'5_q32 == fixed_point<int64_t, 32>::from_raw(4294967296000ll + 2147484));
+	static_assert((0.000000000000000000000000000000000001_q31).raw() == 0);
+
+	static_assert(1.25_r == rational<std::intmax_t>(5, 4));
+	static_assert((1.25_r).numerator() == 5 && (1.25_r).denominator() == 4);
+	static_assert((0.5_r).numerator() == 1 && (0.5_r).denominator() == 2);
+	static_assert((7_r).numerator() == 7 && (7_r).denominator() == 1);
+
+	static_assert(64_KiB == 65536);
+	static_assert(1_MiB == 1024 * 1024);
+	static_assert(3_GiB == 3ull << 30);
+	static_assert(0x10_KiB == 16384);
 	return 0;
 }
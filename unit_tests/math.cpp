@@ -4,6 +4,8 @@
 #include <random>
 #include <iostream>
 #include <iomanip>
+#include <vector>
+#include <array>
 #include "simple/support/random.hpp"
 #include "simple/support/math.hpp"
 using namespace simple::support;
@@ -69,6 +71,85 @@ void FloatTruncation()
 
 }
 
+template <typename Float>
+void check_ulp_comparison(random::engine::tiny<unsigned long long>& random)
+{
+	assert( ulp_distance(Float{1}, Float{1}) == 0 );
+	assert( ulp_distance(Float{0}, -Float{0}) == 0 );
+	assert( ulp_distance(Float{1}, std::nextafter(Float{1}, Float{2})) == 1 );
+	assert( ulp_distance(Float{1}, std::nextafter(Float{1}, Float{0})) == 1 );
+	assert( ulp_distance(-std::numeric_limits<Float>::denorm_min(),
+		std::numeric_limits<Float>::denorm_min()) == 2 );
+	assert( ulp_distance(std::numeric_limits<Float>::max(),
+		std::numeric_limits<Float>::infinity()) == 1 );
+	const Float nan = std::numeric_limits<Float>::quiet_NaN();
+	assert( ulp_distance(nan, nan) == ~decltype(ulp_distance(nan, nan)){} );
+	assert( ulp_distance(Float{1}, nan) == ~decltype(ulp_distance(nan, nan)){} );
+
+	std::uniform_real_distribution<Float> number{-1000, 1000};
+	std::uniform_int_distribution<int> nudge{0, 7};
+	std::vector<Float> golden(1000);
+	for(auto& x : golden)
+		x = number(random);
+	auto result = golden;
+
+	auto comparison = compare_ulp(golden, result, 0);
+	assert( comparison );
+	assert( comparison.mismatches == 0 );
+	assert( comparison.first_mismatch == golden.size() );
+	assert( comparison.max_distance == 0 );
+
+	std::size_t expected_mismatches = 0;
+	std::size_t expected_first = golden.size();
+	std::uintmax_t expected_max = 0;
+	for(std::size_t i = 0; i < result.size(); ++i)
+	{
+		std::uintmax_t ulps = nudge(random);
+		for(std::uintmax_t j = 0; j < ulps; ++j)
+			result[i] = std::nextafter(result[i], Float{2000});
+		if(ulps > 2)
+		{
+			++expected_mismatches;
+			if(expected_first == golden.size())
+				expected_first = i;
+		}
+		expected_max = std::max(expected_max, ulps);
+
+		assert( ulp_distance(golden[i], result[i]) == ulps );
+		assert( equal_ulp(golden[i], result[i], 8) );
+	}
+
+	comparison = compare_ulp(golden, result, 2);
+	assert( !comparison );
+	assert( comparison.mismatches == expected_mismatches );
+	assert( comparison.first_mismatch == expected_first );
+	assert( comparison.max_distance == expected_max );
+
+	comparison = compare_ulp(golden.begin() + 10, golden.begin() + 20, result.begin() + 10, 7);
+	assert( comparison );
+	assert( comparison.first_mismatch == 10 );
+
+	result.back() = nan;
+	comparison = compare_ulp(golden, result, 7);
+	assert( comparison.mismatches == 1 );
+	assert( comparison.first_mismatch == golden.size() - 1 );
+	assert( comparison.max_distance == ~decltype(ulp_distance(nan, nan)){} );
+}
+
+void FloatUlpComparison()
+{
+	auto seed = std::random_device{}();
+	std::cout << "Float ulp comparison test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+	check_ulp_comparison<float>(random);
+	check_ulp_comparison<double>(random);
+
+	constexpr std::array<float, 3> a{1, 2, 3};
+	constexpr std::array<float, 3> b{1, 2, 4};
+	static_assert( compare_ulp(a, a, 0) );
+	static_assert( compare_ulp(a, b, 0).first_mismatch == 2 );
+}
+
 void BabelonianSquareRoot()
 {
 	auto seed = std::random_device{}();
@@ -106,9 +187,365 @@ void BabelonianSquareRoot()
 	assert( babelonian_root2_f(x) == x );
 }
 
+template <typename Float>
+void check_root2_estimate(random::engine::tiny<unsigned long long>& random)
+{
+	std::uniform_real_distribution<Float> mantissa{1, 2};
+	// almost_equal is not very picky about tiny numbers or huge numbers (x+y overflows),
+	// so let's stay clear of those
+	std::uniform_int_distribution<int> exponent{
+		std::numeric_limits<Float>::min_exponent + std::numeric_limits<Float>::digits,
+		std::numeric_limits<Float>::max_exponent - 3
+	};
+	for(int i = 0; i < 1'000'000; ++i)
+	{
+		Float n = std::ldexp(mantissa(random), exponent(random));
+		auto guess = detail::root_estimate<2>(n);
+		assert( std::abs(guess.value/std::sqrt(n) - 1) <= Float{1}/(1 << guess.correct_bits) );
+
+		int iterations = 0;
+		auto counting_eq = [&iterations](Float a, Float b)
+		{
+			++iterations;
+			return almost_equal(a,b);
+		};
+		Float root = babelonian_root2(n, counting_eq);
+		assert( iterations <= detail::root2_iteration_bound<Float>(guess.correct_bits) );
+		assert( almost_equal(root, std::sqrt(n)) );
+	}
+}
+
+void BabelonianIterationBound()
+{
+	auto seed = std::random_device{}();
+	std::cout << "Babelonian iteration bound test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+	check_root2_estimate<float>(random);
+	check_root2_estimate<double>(random);
+	check_root2_estimate<long double>(random);
+
+	static_assert( detail::root2_iteration_bound<float>(4) == 4 );
+	static_assert( detail::root2_iteration_bound<double>(4) == 5 );
+
+	// the equality check has the final say, even past the bound
+	int calls = 0;
+	auto tenth_time = [&calls](auto, auto) { return ++calls == 10; };
+	assert( almost_equal(babelonian_root2(2.0, tenth_time), std::sqrt(2.0)) );
+	assert( calls == 10 );
+
+	// a picky one would never finish, unless bounded explicitly
+	auto never_equal = [](auto, auto) { return false; };
+	auto guess = detail::root_estimate<2>(2.0);
+	assert( almost_equal(babelonian_root2(2.0, guess.value, never_equal,
+		detail::root2_iteration_bound<double>(guess.correct_bits)), std::sqrt(2.0)) );
+}
+
+template <int N, typename Float>
+void check_float_root(random::engine::tiny<unsigned long long>& random)
+{
+	std::uniform_real_distribution<Float> mantissa{1, 2};
+	std::uniform_int_distribution<int> exponent{
+		std::numeric_limits<Float>::min_exponent - std::numeric_limits<Float>::digits,
+		std::numeric_limits<Float>::max_exponent - 2
+	};
+	for(int i = 0; i < 100'000; ++i)
+	{
+		Float n = std::ldexp(mantissa(random), exponent(random));
+		// raising it back rounds N - 1 more times
+		assert( equal_ulp(detail::power<N>(root<N>(n)), n, 2 * N) );
+		// pow with rounded 1/N is not precise enough for tiny or huge numbers,
+		// unless it's done in a wider type
+		if constexpr (N == 3 || sizeof(Float) < sizeof(long double))
+		{
+			Float expected = N == 3 ? std::cbrt(n) :
+				Float(std::pow(static_cast<long double>(n), 1.0L/N));
+			assert( equal_ulp(root<N>(n), expected, 4) );
+		}
+		if constexpr (N % 2 == 1)
+			assert( root<N>(-n) == -root<N>(n) );
+	}
+}
+
+template <int N, typename Int>
+void check_integer_root(random::engine::tiny<unsigned long long>& random)
+{
+	using limits = std::numeric_limits<Int>;
+	std::uniform_int_distribution<Int> number{0, limits::max()};
+	auto check = [](Int n)
+	{
+		auto r = root<N>(n);
+		using wide = long double;
+		assert( std::pow(wide(r), N) <= wide(n) );
+		assert( std::pow(wide(r) + 1, N) > wide(n) );
+	};
+	for(int i = 0; i < 100'000; ++i)
+	{
+		check(number(random));
+		check(number(random) >> (number(random) % limits::digits));
+	}
+	check(limits::max());
+	check(0);
+	check(1);
+}
+
+void NthRoot()
+{
+	auto seed = std::random_device{}();
+	std::cout << "Nth root test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+
+	check_float_root<3, float>(random);
+	check_float_root<3, double>(random);
+	check_float_root<4, double>(random);
+	check_float_root<5, double>(random);
+	check_float_root<7, float>(random);
+	check_float_root<3, long double>(random);
+	check_float_root<5, long double>(random);
+
+	check_integer_root<3, unsigned long long>(random);
+	check_integer_root<3, int>(random);
+	check_integer_root<5, unsigned long long>(random);
+	check_integer_root<7, unsigned>(random);
+	check_integer_root<3, unsigned short>(random);
+
+	assert( root<3>(27) == 3 );
+	assert( root<3>(-27) == -3 );
+	assert( root<3>(26) == 2 );
+	assert( root<3>(-26) == -2 );
+	assert( root<2>(26) == 5 );
+	assert( root<1>(26) == 26 );
+	assert( root<3>(27.0) == 3.0 );
+	assert( root<4>(16.0) == 2.0 );
+	assert( std::isnan(root<4>(-16.0)) );
+	assert( root<3>(std::numeric_limits<double>::infinity()) == std::numeric_limits<double>::infinity() );
+	assert( root<3>(0.0) == 0.0 );
+
+	static_assert( root<3>(1'000'000'000'000'000'000ull) == 1'000'000ull );
+	static_assert( root<3>(8.0) == 2.0 );
+	static_assert( root<10>(1024.0) == 2.0 );
+}
+
+template <typename Int>
+void check_isqrt(Int root)
+{
+	const Int square = root * root;
+	assert( isqrt(square) == root );
+	if(square != 0)
+		assert( isqrt(Int(square - 1)) == root - 1 );
+	if(root == 0 || root < std::numeric_limits<Int>::max() / root)
+		assert( isqrt(Int(square + 2*root)) == root );
+}
+
+void IntegerSquareRoot()
+{
+	for(unsigned i = 0; i <= 0xffff; ++i)
+		assert( isqrt(i) * isqrt(i) <= i && (isqrt(i)+1) * (isqrt(i)+1) > i );
+	for(unsigned char i = 0; i < 255; ++i)
+		assert( isqrt(i) * isqrt(i) <= i && (isqrt(i)+1) * (isqrt(i)+1) > i );
+
+	auto seed = std::random_device{}();
+	std::cout << "Integer square root test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+	for(int i = 0; i < 1'000'000; ++i)
+	{
+		const unsigned long long r = random();
+		check_isqrt<unsigned long long>(r >> 32);
+		check_isqrt<long long>(r >> 33);
+		check_isqrt<unsigned>(r >> 48);
+		check_isqrt<int>(r >> 49);
+		const unsigned long long n = random();
+		const auto root = isqrt(n);
+		assert( root * root <= n );
+		assert( root == 0xffff'ffff || (root + 1) * (root + 1) > n );
+	}
+
+	assert( isqrt(std::numeric_limits<unsigned long long>::max()) == 0xffff'ffff );
+	assert( isqrt(std::numeric_limits<long long>::max()) == 3037000499 );
+	assert( isqrt(std::numeric_limits<unsigned>::max()) == 0xffff );
+	assert( isqrt(std::numeric_limits<int>::max()) == 46340 );
+	assert( isqrt((1ull << 52) + (1ull << 27)) == (1ull << 26) );
+	assert( isqrt((1ull << 52) + (1ull << 27) + 1) == (1ull << 26) + 1 );
+	assert( isqrt(((1ull << 32) - 1) * ((1ull << 32) - 1) - 1) == (1ull << 32) - 2 );
+
+	std::vector<unsigned long long> roots;
+	isqrt(std::array{0ull, 1ull, 3ull, 4ull, 99ull, 100ull}, std::back_inserter(roots));
+	assert(( roots == std::vector<unsigned long long>{0, 1, 1, 2, 9, 10} ));
+
+	static_assert( isqrt(0) == 0 );
+	static_assert( isqrt(1) == 1 );
+	static_assert( isqrt(15) == 3 );
+	static_assert( isqrt(16) == 4 );
+	static_assert( isqrt(0xffff'ffff'ffff'ffffull) == 0xffff'ffffull );
+	static_assert( detail::bitwise_isqrt(0xffff'ffff'ffff'ffffull) == 0xffff'ffffull );
+	static_assert( detail::bitwise_isqrt(1'000'000u) == 1000u );
+}
+
+template <int Steps, typename Float>
+void check_rsqrt(random::engine::tiny<unsigned long long>& random, Float tolerance)
+{
+	std::uniform_real_distribution<Float> number{std::numeric_limits<Float>::min(), 1e30};
+	for(int i = 0; i < 100'000; ++i)
+	{
+		Float x = number(random);
+		assert( std::abs(rsqrt<Steps>(x) * std::sqrt(x) - 1) < tolerance );
+		x = 1 / number(random);
+		assert( std::abs(rsqrt<Steps>(x) * std::sqrt(x) - 1) < tolerance );
+	}
+}
+
+void ReciprocalSquareRoot()
+{
+	auto seed = std::random_device{}();
+	std::cout << "Reciprocal square root test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+
+	check_rsqrt<0>(random, 0.04f);
+	check_rsqrt<1>(random, 0.002f);
+	check_rsqrt<2>(random, 0.00001f);
+	check_rsqrt<0>(random, 0.04);
+	check_rsqrt<1>(random, 0.002);
+	check_rsqrt<2>(random, 0.00001);
+	check_rsqrt<4>(random, 1e-15);
+	check_rsqrt<1>(random, 1e-15L);
+
+	std::vector<float> roots;
+	rsqrt<3>(std::array{1.f, 4.f, 16.f, 0.25f}, std::back_inserter(roots));
+	for(auto [root, expected] : {std::pair{0,1.f}, {1,0.5f}, {2,0.25f}, {3,2.f}})
+		assert( std::abs(roots[root] - expected) < 1e-6f );
+}
+
+// exact reference through floor division of a wider type
+template <rounding Mode>
+long long reference_muldiv(long long one, long long other, long long divisor)
+{
+	const long long product = one * other;
+	long long floor = product / divisor;
+	if((product % divisor != 0) && ((product < 0) != (divisor < 0)))
+		--floor;
+	const long long remainder = product - floor * divisor; // same sign as divisor
+	switch(Mode)
+	{
+		case rounding::floor: return floor;
+		case rounding::ceil: return floor + (remainder != 0);
+		case rounding::toward_zero: return product / divisor;
+		case rounding::nearest:
+		{
+			const long long twice = 2 * (divisor < 0 ? -remainder : remainder);
+			const long long abs_divisor = divisor < 0 ? -divisor : divisor;
+			const bool negative = (product < 0) != (divisor < 0);
+			if(twice > abs_divisor || (twice == abs_divisor && !negative))
+				return floor + 1;
+			return floor;
+		}
+	}
+	return 0;
+}
+
+template <rounding Mode, typename Int>
+void check_small_muldiv()
+{
+	constexpr long long min = std::numeric_limits<Int>::min(), max = std::numeric_limits<Int>::max();
+	for(long long one = min; one <= max; ++one)
+	for(long long other = min; other <= max; other += 3)
+	for(long long divisor = min; divisor <= max; divisor += 5)
+	{
+		if(divisor == 0)
+			continue;
+		const long long expected = reference_muldiv<Mode>(one, other, divisor);
+		if(expected < min || expected > max)
+			continue;
+		assert( muldiv<Mode>(Int(one), Int(other), Int(divisor)) == expected );
+	}
+}
+
+template <rounding Mode>
+void check_wide_muldiv(random::engine::tiny<unsigned long long>& random)
+{
+	__extension__ using int128_t = __int128;
+	for(int i = 0; i < 10000; ++i)
+	{
+		const auto one = std::int64_t(random()), other = std::int64_t(random() >> (random() % 64));
+		auto divisor = std::int64_t(random());
+		if(divisor == 0)
+			divisor = 1;
+		const int128_t product = int128_t(one) * other;
+		int128_t floor = product / divisor;
+		if(product % divisor != 0 && ((product < 0) != (divisor < 0)))
+			--floor;
+		const int128_t remainder = product - floor * divisor;
+		int128_t expected = floor;
+		if(Mode == rounding::ceil)
+			expected += remainder != 0;
+		if(Mode == rounding::toward_zero)
+			expected = product / divisor;
+		if(Mode == rounding::nearest)
+		{
+			const int128_t twice = 2 * (divisor < 0 ? -remainder : remainder);
+			const int128_t abs_divisor = divisor < 0 ? -int128_t(divisor) : int128_t(divisor);
+			if(twice > abs_divisor || (twice == abs_divisor && (product >= 0) == (divisor >= 0)))
+				++expected;
+		}
+		if(expected < std::numeric_limits<std::int64_t>::min() || expected > std::numeric_limits<std::int64_t>::max())
+			continue;
+		assert( muldiv<Mode>(one, other, divisor) == expected );
+
+		const auto unsigned_one = std::uint64_t(one), unsigned_other = std::uint64_t(other), unsigned_divisor = std::uint64_t(divisor) | 1;
+		__extension__ using uint128_t = unsigned __int128;
+		const uint128_t unsigned_product = uint128_t(unsigned_one) * unsigned_other;
+		uint128_t unsigned_expected = unsigned_product / unsigned_divisor;
+		const uint128_t unsigned_remainder = unsigned_product % unsigned_divisor;
+		if(Mode == rounding::ceil)
+			unsigned_expected += unsigned_remainder != 0;
+		if(Mode == rounding::nearest)
+			unsigned_expected += unsigned_remainder >= unsigned_divisor - unsigned_remainder;
+		if(unsigned_expected > std::numeric_limits<std::uint64_t>::max())
+			continue;
+		assert( muldiv<Mode>(unsigned_one, unsigned_other, unsigned_divisor) == unsigned_expected );
+	}
+}
+
+void MultiplyDivide()
+{
+	check_small_muldiv<rounding::toward_zero, std::int8_t>();
+	check_small_muldiv<rounding::floor, std::int8_t>();
+	check_small_muldiv<rounding::ceil, std::int8_t>();
+	check_small_muldiv<rounding::nearest, std::int8_t>();
+	check_small_muldiv<rounding::toward_zero, std::uint8_t>();
+	check_small_muldiv<rounding::floor, std::uint8_t>();
+	check_small_muldiv<rounding::ceil, std::uint8_t>();
+	check_small_muldiv<rounding::nearest, std::uint8_t>();
+
+	auto seed = std::random_device{}();
+	std::cout << "Muldiv test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+	check_wide_muldiv<rounding::toward_zero>(random);
+	check_wide_muldiv<rounding::floor>(random);
+	check_wide_muldiv<rounding::ceil>(random);
+	check_wide_muldiv<rounding::nearest>(random);
+
+	// the product overflows, the result doesn't
+	constexpr auto max = std::numeric_limits<std::int64_t>::max();
+	static_assert( muldiv(max, max, max) == max );
+	static_assert( muldiv<rounding::ceil>(max, std::int64_t{3}, std::int64_t{6}) == max / 2 + 1 );
+	static_assert( muldiv<rounding::nearest>(-5, 1, 2) == -3 );
+	static_assert( muldiv<rounding::floor>(-5, 1, 2) == -3 );
+	static_assert( muldiv<rounding::ceil>(-5, 1, 2) == -2 );
+	static_assert( muldiv(std::numeric_limits<int>::min(), -1, -1) == std::numeric_limits<int>::min() );
+
+	std::vector<std::uint64_t> rates{~std::uint64_t{}, 1000, 3};
+	std::vector<std::uint64_t> scaled;
+	muldiv<rounding::nearest>(rates, std::back_inserter(scaled), 2, 3);
+	assert(( scaled == std::vector<std::uint64_t>{~std::uint64_t{} / 3 * 2, 667, 2} ));
+}
+
 constexpr bool Constexpr()
 {
 	void(root2(2.0));
+	void(babelonian_root2_f(1e300));
+	void(babelonian_root2_f(1e-300));
+	void(root<3>(1e300));
+	void(isqrt(2));
+	void(rsqrt(2.0));
 	return true;
 }
 
@@ -116,7 +553,13 @@ int main()
 {
 	FloatEquality();
 	FloatTruncation();
+	FloatUlpComparison();
 	BabelonianSquareRoot();
+	BabelonianIterationBound();
+	NthRoot();
+	IntegerSquareRoot();
+	ReciprocalSquareRoot();
+	MultiplyDivide();
 	static_assert(Constexpr(),"");
 	return 0;
 }
@@ -2,8 +2,15 @@
 #include <iostream>
 #include <iomanip>
 #include <string>
+#include <random>
+#include <cstring>
+#include <cerrno>
+#include <cmath>
+#include <vector>
 
 #include "simple/support/misc.hpp"
+#include "simple/support/random.hpp"
+#include "simple/support/algorithm/split.hpp"
 
 using namespace simple::support;
 
@@ -59,6 +66,26 @@ void StringToNumericRange()
 	assert( (range<int>{2,34} == storn<int>("12-34.xyz", &i)) );
 	assert( 5 == i );
 
+	// one after another, without copies or exceptions
+	const std::string_view ranges = "1-2 3:4\t-5--1 x";
+	const char* current = ranges.data();
+	const char* const end = ranges.data() + ranges.size();
+	range<int> r{};
+	auto result = strton(current, end, r);
+	assert( std::errc{} == result.ec && (range<int>{1,2} == r) );
+	result = strton(current = result.ptr, end, r);
+	assert( std::errc{} == result.ec && (range<int>{3,7} == r) );
+	result = strton(current = result.ptr, end, r);
+	assert( std::errc{} == result.ec && (range<int>{-5,-1} == r) );
+	result = strton(current = result.ptr, end, r);
+	assert( std::errc::invalid_argument == result.ec && current == result.ptr && (range<int>{-5,-1} == r) );
+	assert( std::errc::result_out_of_range == strton("1-9999999999", r).ec );
+	assert( std::errc::invalid_argument == strton("1", r).ec );
+
+	std::vector<range<int>> all;
+	parse_numbers<range<int>>("1-2, 3:4,0x10-0x20", ',', std::back_inserter(all));
+	assert(( all == std::vector<range<int>>{{1,2}, {3,7}, {16,32}} ));
+
 	try {
 		storn<int>("1232");
 		assert( ((void)"storn did not throw an invalid argument exception", false) );
@@ -80,7 +107,26 @@ void NumericRangeToString()
 	assert( "12-34" == tos(range<int>{12,34}) );
 	assert( "12~34" == to_string(range<int>{12,34}, '~') );
 	assert( "12:34" == to_string(range<int>{12,46}, ':') );
+	assert( "0-1" == to_string(range<bool>{false,true}) );
 	assert( tos(-12.34) + '-' + tos(12.34) == tos(range<double>{-12.34,12.34}) );
+	assert( "-2147483648-2147483647" == tos(range<int>::limit()) );
+
+	char buffer[32];
+	auto written = [&](std::to_chars_result result)
+	{
+		assert( std::errc{} == result.ec );
+		return std::string_view(buffer, result.ptr - buffer);
+	};
+	assert( "12-34" == written(to_chars(buffer, buffer + sizeof(buffer), range<int>{12,34})) );
+	assert( "-12:34" == written(to_chars(buffer, buffer + sizeof(buffer), range<int>{-12,22}, ':')) );
+	assert( "0.1--1e+300" == written(to_chars(buffer, buffer + sizeof(buffer), range<double>{0.1,-1e300})) );
+	assert( (range<double>{0.1,-1e300} == storn<double>(written(to_chars(buffer, buffer + sizeof(buffer), range<double>{0.1,-1e300})))) );
+
+	// too small
+	assert( std::errc::value_too_large == to_chars(buffer, buffer + 2, range<int>{12,34}).ec );
+	assert( std::errc::value_too_large == to_chars(buffer, buffer + 3, range<int>{12,34}).ec );
+	assert( std::errc::value_too_large == to_chars(buffer, buffer + 4, range<int>{12,34}).ec );
+	assert( std::errc{} == to_chars(buffer, buffer + 5, range<int>{12,34}).ec );
 }
 
 void SimplifiedToNumber()
@@ -136,9 +182,171 @@ void RangeReference()
 
 }
 
+// the string_view overload against the null terminated one, that goes through the C library
+template <typename N>
+void check_same_as_c(const std::string& text)
+{
+	errno = 0;
+	char* c_end = nullptr;
+	const N expected = strton<N>(text.c_str(), &c_end);
+	const bool c_out_of_range = errno == ERANGE;
+
+	// copy to a buffer with garbage after, to make sure the end is respected
+	std::string buffer = text + "1234";
+	N value{};
+	const auto [end, error] = strton(std::string_view(buffer.data(), text.size()), value);
+	if(c_end == text.c_str())
+	{
+		assert( error == std::errc::invalid_argument );
+		assert( end == buffer.data() );
+		return;
+	}
+	assert( end - buffer.data() == c_end - text.c_str() );
+	if constexpr (std::is_floating_point_v<N>)
+	{
+		if(c_out_of_range && std::fpclassify(expected) == FP_SUBNORMAL)
+		{
+			assert( error == std::errc{} );
+			assert( value == expected );
+			return;
+		}
+	}
+	assert( c_out_of_range == (error == std::errc::result_out_of_range) );
+	if(!c_out_of_range || std::is_integral_v<N>)
+		assert( std::memcmp(&value, &expected, sizeof(N)) == 0 );
+}
+
+void StringViewToNumber()
+{
+	auto seed = std::random_device{}();
+	std::cout << "String to number test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+
+	const char* pieces[] = {" ", "\t", "-", "+", "0", "0x", "0X", "1", "7", "8", "9", "a", "F", "g", "x", ".", "e", "e-", "p",
+		"123456789", "99999999999999999999", "18446744073709551615", "0000000012345678", "inf", "nan", "infinity", "1e400", "1e-400", ",", ""};
+	for(int i = 0; i < 100000; ++i)
+	{
+		std::string text;
+		const int count = 1 + random() % 6;
+		for(int j = 0; j < count; ++j)
+			text += pieces[random() % std::size(pieces)];
+		check_same_as_c<int>(text);
+		check_same_as_c<long>(text);
+		check_same_as_c<unsigned char>(text);
+		check_same_as_c<signed char>(text);
+		check_same_as_c<unsigned>(text);
+		check_same_as_c<unsigned long long>(text);
+		check_same_as_c<double>(text);
+		check_same_as_c<float>(text);
+	}
+
+	// parsing fields out of a larger buffer without copies
+	const std::string_view line = "12,-0x1f,3.5,xyz";
+	std::size_t i = 0;
+	assert( 12 == ston<int>(line, &i) );
+	assert( ',' == line[i++] );
+	assert( -31 == ston<int>(line, &i) );
+	assert( ',' == line[i++] );
+	assert( 3.5 == ston<double>(line, &i) );
+	assert( std::nullopt == to_<int>(line.substr(i + 1)) );
+	assert( 3 == *to_<int>(line.substr(9, 1)) );
+
+	int value = 0;
+	assert( strton(line.substr(0, 1), value).ec == std::errc{} && value == 1 );
+	assert( strton("999999999999", value).ec == std::errc::result_out_of_range );
+	assert( value == std::numeric_limits<int>::max() );
+}
+
+template <typename N>
+std::vector<N> split_ston(std::string_view text, std::string_view separator)
+{
+	std::vector<range<std::string_view::iterator>> fields;
+	split(text, separator, std::back_inserter(fields));
+	std::vector<N> result;
+	for(auto&& field : fields)
+		result.push_back(ston<N>(std::string_view(&*field.begin(), field.end() - field.begin())));
+	return result;
+}
+
+void ParseNumbers()
+{
+	auto seed = std::random_device{}();
+	std::cout << "Parse numbers test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+
+	std::vector<int> ints;
+	parse_numbers<int>("1,-2,+3, 4,0x10,010", ',', std::back_inserter(ints));
+	assert(( ints == std::vector<int>{1, -2, 3, 4, 16, 8} ));
+
+	std::vector<double> doubles;
+	parse_numbers<double>("1.5--2e3--0x1p-1", "--", std::back_inserter(doubles));
+	assert(( doubles == std::vector<double>{1.5, 2000, 0.5} ));
+
+	// digits converted eight at a time and one by one give the same thing
+	std::vector<unsigned long long> longs;
+	parse_numbers<unsigned long long>("12345678;123456789012345678;18446744073709551615;1234567", ';', std::back_inserter(longs));
+	assert(( longs == std::vector<unsigned long long>{12345678, 123456789012345678, 18446744073709551615ull, 1234567} ));
+
+	// empty fields are fields, just like with split, and can't be parsed
+	bool thrown = false;
+	try
+	{
+		std::vector<int> out;
+		parse_numbers<int>("1,2,", ',', std::back_inserter(out));
+	}
+	catch(const std::invalid_argument&) { thrown = true; }
+	assert(thrown);
+
+	thrown = false;
+	try
+	{
+		std::vector<short> out;
+		parse_numbers<short>("1,99999", ',', std::back_inserter(out));
+	}
+	catch(const std::out_of_range&) { thrown = true; }
+	assert(thrown);
+
+	const char* pieces[] = {"0", "1", "9", "-", " ", "12345678", "9876543210987654321", "00000000", ".", "e5", "x"};
+	const std::string_view separators[] = {",", ";;", "\n"};
+	for(int i = 0; i < 10000; ++i)
+	{
+		const std::string_view separator = separators[random() % std::size(separators)];
+		std::string text;
+		const int fields = 1 + random() % 8;
+		for(int field = 0; field < fields; ++field)
+		{
+			if(field != 0)
+				text += separator;
+			text += std::to_string(random() % 10); // never empty
+			const int count = random() % 4;
+			for(int j = 0; j < count; ++j)
+				text += pieces[random() % std::size(pieces)];
+		}
+
+		auto check = [&](auto type)
+		{
+			using N = decltype(type);
+			std::vector<N> expected, actual;
+			bool expected_thrown = false, actual_thrown = false;
+			try { expected = split_ston<N>(text, separator); }
+			catch(const std::exception&) { expected_thrown = true; }
+			try { parse_numbers<N>(text, separator, std::back_inserter(actual)); }
+			catch(const std::exception&) { actual_thrown = true; }
+			assert( expected_thrown == actual_thrown );
+			if(!expected_thrown)
+				assert( expected == actual );
+		};
+		check(int{});
+		check(0ull);
+		check(double{});
+	}
+}
+
 int main()
 {
 	StringToNumber();
+	StringViewToNumber();
+	ParseNumbers();
 	StringToNumericRange();
 	NumericRangeToString();
 	SimplifiedToNumber();
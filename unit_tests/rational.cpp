@@ -1,7 +1,18 @@
 #include "simple/support/rational.hpp"
+#include <limits>
+#include <cassert>
+#include <cstdint>
+#include <cmath>
+#include <random>
+#include <iostream>
+#include <iomanip>
+#include "simple/support/random.hpp"
 
 using simple::support::rational;
 using simple::support::meta_constant;
+using simple::support::rounding;
+using simple::support::normalized;
+using simple::support::gcd;
 
 constexpr bool Ratio()
 {
@@ -40,11 +51,283 @@ constexpr bool Ratio()
 	assertion &= (quarter * 2) == rational(2, meta_constant<int,4>{});
 	assertion &= onenhalf == rational(3, meta_constant<int,2>{});
 
+	// scaling doesn't overflow in between
+	constexpr auto big = std::numeric_limits<int>::max();
+	static_assert(rational{2,3}.scale(big) == int(2 * (long long)(big) / 3));
+	static_assert(rational{2,3}.scale<rounding::nearest>(big) == 1431655765);
+	static_assert(rational{1,4}.scale<rounding::floor>(-5) == -2);
+	static_assert(rational(3, meta_constant<int,4>{}).scale<rounding::ceil>(big) == 1610612736);
+	static_assert(rational{1.0,4.0}.scale(2.0) == 0.5);
+
+	return assertion;
+}
+
+constexpr bool Gcd()
+{
+	static_assert(gcd(0,0) == 0);
+	static_assert(gcd(0,5) == 5);
+	static_assert(gcd(12,18) == 6);
+	static_assert(gcd(-12,18) == 6);
+	static_assert(gcd(std::uint64_t{1} << 63, std::uint64_t{3} << 40) == std::uint64_t{1} << 40);
+	static_assert(gcd(std::uint8_t{255}, std::uint8_t{85}) == 85);
+	static_assert(simple::support::lcm(4,-6) == 12);
+	return true;
+}
+
+void GcdAgainstEuclid()
+{
+	auto euclid = [](unsigned a, unsigned b)
+	{
+		while(b != 0)
+		{
+			auto t = a % b;
+			a = b;
+			b = t;
+		}
+		return a;
+	};
+	for(unsigned a = 0; a < 300; ++a)
+		for(unsigned b = 0; b < 300; ++b)
+			assert( gcd(a, b) == euclid(a, b) );
+}
+
+constexpr bool Normalized()
+{
+	using q = rational<int, normalized<>>;
+	static_assert(q{6,4}.numerator() == 3 && q{6,4}.denominator() == 2);
+	static_assert(q{6,-4}.numerator() == -3 && q{6,-4}.denominator() == 2);
+	static_assert(q{0,-4}.numerator() == 0 && q{0,-4}.denominator() == 1);
+	static_assert(q{1,2} == q{2,4});
+	static_assert(q{1,3} < q{1,2});
+	static_assert(q{-1,2} < q{1,3});
+	static_assert(q{1,2} + q{1,3} == q{5,6});
+	static_assert(q{1,2} - q{1,3} == q{1,6});
+	static_assert(q{1,6} + q{1,3} == q{1,2});
+	static_assert(q{2,3} * q{3,4} == q{1,2});
+	static_assert(int(q{7,2} * 4) == 14);
+
+	// long chains of conversions stay small
+	q ratio{1,1};
+	for(int i = 0; i < 1000; ++i)
+	{
+		ratio *= q{1001, 1000};
+		ratio *= q{1000, 1001};
+	}
+	bool assertion = ratio.numerator() == 1 && ratio.denominator() == 1;
+
+	// 30000/1001 frames per second, to 48000 samples per second
+	auto samples_per_frame = q{48000,1} * q{1001,30000};
+	assertion &= samples_per_frame == q{8008,5};
+
+	// unnormalized ones compare without overflow
+	constexpr auto big = std::numeric_limits<int>::max();
+	static_assert(rational{big, big - 1} < rational{big - 1, big - 2});
+	static_assert(rational{big - 1, big} < rational{big, big - 1});
+	static_assert(rational{-1, -2} == rational{1, 2});
+	static_assert(rational{1, -2} < rational{1, 3});
+	static_assert(rational{std::int64_t{1} << 62, std::int64_t{3}} < rational{(std::int64_t{1} << 62) + 1, std::int64_t{3}});
+	static_assert(rational{std::int64_t{3} << 60, std::int64_t{6} << 60} == rational{std::int64_t{1}, std::int64_t{2}});
+
 	return assertion;
 }
 
+void CheckedOverflow()
+{
+	using q = rational<std::int32_t, normalized<true>>;
+	q ratio{1,3};
+	ratio *= q{2,5};
+	assert( ratio.valid() );
+	assert( ratio == q(2,15) );
+	// coprime denominators can't cancel
+	ratio *= q{1, 1'000'003};
+	ratio *= q{1, 999'983};
+	assert( !ratio.valid() );
+	ratio = q{1, 65536};
+	ratio += q{1, 65535};
+	assert( !ratio.valid() );
+	ratio = q{1, 2};
+	ratio += std::numeric_limits<std::int32_t>::max() / 2;
+	assert( ratio.valid() );
+	ratio += 1;
+	assert( !ratio.valid() );
+	ratio.reset_overflow();
+	assert( ratio.valid() );
+}
+
+template <typename Int, Int Denominator>
+void check_known_denominator(Int numerator)
+{
+	const auto ratio = rational(numerator, meta_constant<Int, Denominator>{});
+	const long long expected = (long long)(numerator) / (long long)(Denominator);
+	const long long remainder = (long long)(numerator) % (long long)(Denominator);
+	assert( (long long)(Int(ratio)) == expected );
+	assert( (long long)(ratio.template round<rounding::toward_zero>()) == expected );
+	assert( (long long)(ratio.template round<rounding::floor>()) == expected - (remainder < 0) );
+	assert( (long long)(ratio.template round<rounding::ceil>()) == expected + (remainder > 0) );
+	const long long twice = 2 * (remainder < 0 ? -remainder : remainder);
+	const long long away = twice >= (long long)(Denominator) ? (numerator < 0 ? -1 : 1) : 0;
+	assert( (long long)(ratio.template round<rounding::nearest>()) == expected + away );
+}
+
+void KnownDenominators()
+{
+	for(int i = -128; i < 128; ++i)
+	{
+		check_known_denominator<std::int8_t, 1>(i);
+		check_known_denominator<std::int8_t, 2>(i);
+		check_known_denominator<std::int8_t, 3>(i);
+		check_known_denominator<std::int8_t, 64>(i);
+		check_known_denominator<std::int8_t, 100>(i);
+		check_known_denominator<std::int8_t, 127>(i);
+		check_known_denominator<std::int32_t, 7>(i * 1'000'003);
+		check_known_denominator<std::int32_t, 1024>(i * 1'000'003);
+		check_known_denominator<std::uint32_t, 10>(std::uint32_t(i) * 1'000'003u);
+		check_known_denominator<std::int64_t, 1000>(std::int64_t(i) << 55);
+		check_known_denominator<std::uint64_t, 3>(std::uint64_t(i + 128) << 54 | 12345);
+	}
+	for(int i = 0; i < 256; ++i)
+	{
+		check_known_denominator<std::uint8_t, 5>(i);
+		check_known_denominator<std::uint8_t, 128>(i);
+	}
+
+	// a denominator only the unsigned type can hold
+	using q15 = meta_constant<std::uint16_t, 32768>;
+	static_assert(rational(std::int16_t{-32768}, q15{}).round() == -1);
+	static_assert(rational(std::int16_t{-16384}, q15{}).round<rounding::floor>() == -1);
+	static_assert(rational(std::int16_t{-16384}, q15{}).round<rounding::nearest>() == -1);
+	static_assert(rational(std::int16_t{16383}, q15{}).round<rounding::nearest>() == 0);
+
+	using simple::support::rational_cast;
+	using quarters = meta_constant<int, 4>;
+	using halves = meta_constant<int, 2>;
+	using thirds = meta_constant<int, 3>;
+	static_assert(rational_cast<halves>(rational(3, quarters{})).numerator() == 1);
+	static_assert(rational_cast<halves, rounding::ceil>(rational(3, quarters{})).numerator() == 2);
+	static_assert(rational_cast<quarters>(rational(3, halves{})).numerator() == 6);
+	static_assert(rational_cast<thirds, rounding::nearest>(rational(3, quarters{})).numerator() == 2);
+	static_assert(rational_cast<thirds, rounding::nearest>(rational(-3, quarters{})).numerator() == -2);
+}
+
+constexpr bool BestRationalKnown()
+{
+	using simple::support::best_rational;
+	constexpr auto pi = best_rational(3.14159265358979323846, 1000);
+	static_assert(pi.numerator() == 355 && pi.denominator() == 113);
+	constexpr auto third = best_rational(1.0/3, 1'000'000);
+	static_assert(third.numerator() == 1 && third.denominator() == 3);
+	constexpr auto ntsc = best_rational(30000.0/1001, 2000);
+	static_assert(ntsc.numerator() == 30000 && ntsc.denominator() == 1001);
+	constexpr auto film = best_rational(-24000.0/1001, 1001);
+	static_assert(film.numerator() == -24000 && film.denominator() == 1001);
+	constexpr auto root2 = best_rational(1.4142135623730951, 100);
+	static_assert(root2.numerator() == 140 && root2.denominator() == 99);
+	constexpr auto exact = best_rational(0.375, 1000);
+	static_assert(exact.numerator() == 3 && exact.denominator() == 8);
+	constexpr auto tiny = best_rational(1e-300, std::numeric_limits<long long>::max());
+	static_assert(tiny.numerator() == 0);
+	constexpr auto huge = best_rational(1e300, 10);
+	static_assert(huge.numerator() == std::numeric_limits<int>::max() && huge.denominator() == 1);
+	constexpr auto small_numerator = best_rational(100.5, std::int8_t{100});
+	static_assert(small_numerator.numerator() == 100 && small_numerator.denominator() == 1);
+	constexpr auto whole = best_rational(1e10, std::int64_t{7});
+	static_assert(whole.numerator() == 10'000'000'000 && whole.denominator() == 1);
+
+	using simple::support::to_float;
+	static_assert(to_float<double>(rational{1,3}) == 1.0/3);
+	static_assert(to_float<float>(rational{-1,3}) == -1.f/3);
+	static_assert(to_float<double>(rational(3, meta_constant<int,4>{})) == 0.75);
+	// 2^53 + 1 is a tie that goes to even
+	static_assert(to_float<double>(rational{(std::uint64_t{1} << 53) + 1, std::uint64_t{1}}) == 9007199254740992.0);
+	static_assert(to_float<double>(rational{(std::uint64_t{1} << 53) + 3, std::uint64_t{1}}) == 9007199254740996.0);
+	return true;
+}
+
+// exact decomposition x = m / 2^k, for checks in integers
+struct dyadic { std::int64_t mantissa; int shift; };
+dyadic decompose(double x)
+{
+	int exponent;
+	const double fraction = std::frexp(x, &exponent);
+	return {std::int64_t(std::ldexp(fraction, 53)), 53 - exponent};
+}
+
+void BestRationalBruteForce()
+{
+	__extension__ using int128 = __int128;
+	auto seed = std::random_device{}();
+	std::cout << "Best rational test seed: " << std::hex << std::showbase << seed << std::endl;
+	simple::support::random::engine::tiny<unsigned long long> random{seed};
+	std::uniform_real_distribution<double> values{-1000, 1000};
+	for(int i = 0; i < 300; ++i)
+	{
+		const double x = values(random) / double(1 + random() % 1000);
+		const int max_denominator = 1 + random() % 2000;
+		const auto best = simple::support::best_rational(x, max_denominator);
+		const auto [mantissa, shift] = decompose(x);
+		assert(shift >= 0 && shift < 80);
+		const int128 scale = int128(1) << shift;
+		// |x - p/q| = |m q - p 2^k| / (2^k q)
+		auto distance = [&](std::int64_t p, std::int64_t q)
+		{
+			const int128 difference = int128(mantissa) * q - int128(p) * scale;
+			return difference < 0 ? -difference : difference;
+		};
+		const std::int64_t best_p = best.numerator(), best_q = best.denominator();
+		assert( best_q > 0 && best_q <= max_denominator );
+		assert( simple::support::gcd(best_p, best_q) == 1 );
+		for(std::int64_t q = 1; q <= max_denominator; ++q)
+		{
+			const auto p = std::int64_t(std::floor(x * double(q)));
+			for(auto candidate : {p - 1, p, p + 1, p + 2})
+				// candidate/q is not closer than best_p/best_q
+				assert( distance(candidate, q) * best_q >= distance(best_p, best_q) * q );
+		}
+	}
+}
+
+void ToFloatCorrectlyRounded()
+{
+	using wide = simple::support::wide_uint<256>;
+	auto seed = std::random_device{}();
+	std::cout << "Rational to float test seed: " << std::hex << std::showbase << seed << std::endl;
+	simple::support::random::engine::tiny<unsigned long long> random{seed};
+	for(int i = 0; i < 100000; ++i)
+	{
+		const std::uint64_t n = (random() >> (random() % 64)) | 1, d = (random() >> (random() % 64)) | 1;
+		const double result = simple::support::to_float<double>(rational{n, d});
+		// result = M * 2^E, check n/d is within half ulp: |4 n - 4 M d 2^E| <= 2 d 2^E
+		int exponent;
+		const double fraction = std::frexp(result, &exponent);
+		const auto mantissa = std::uint64_t(std::ldexp(fraction, 53));
+		exponent -= 53;
+		// powers of two have a smaller ulp below
+		const std::uint64_t below = mantissa == std::uint64_t{1} << 52 ? 1 : 2;
+		wide scaled_n = wide(n) << 2, lower = wide(4 * mantissa - below) * wide(d), upper = wide(4 * mantissa + 2) * wide(d);
+		if(exponent < 0)
+			scaled_n <<= -exponent;
+		else
+		{
+			lower <<= exponent;
+			upper <<= exponent;
+		}
+		assert( scaled_n >= lower && scaled_n <= upper );
+		// ties to even
+		if(scaled_n == lower || scaled_n == upper)
+			assert( mantissa % 2 == 0 );
+	}
+}
+
 int main()
 {
 	static_assert(Ratio());
+	static_assert(Gcd());
+	static_assert(Normalized());
+	GcdAgainstEuclid();
+	CheckedOverflow();
+	KnownDenominators();
+	static_assert(BestRationalKnown());
+	BestRationalBruteForce();
+	ToFloatCorrectlyRounded();
 	return 0;
 }
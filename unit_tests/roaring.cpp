@@ -0,0 +1,358 @@
+#include "simple/support/roaring.hpp"
+#include "simple/support/random.hpp"
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <iterator>
+
+using namespace simple::support;
+
+using values = std::vector<std::uint32_t>;
+
+template <typename Roaring>
+values to_values(const Roaring& r)
+{
+	values result;
+	r.for_each([&result](std::uint32_t value) { result.push_back(value); });
+	return result;
+}
+
+void Basics()
+{
+	roaring_bitmap r;
+	assert( r.empty() );
+	assert( r.add(1) );
+	assert( !r.add(1) );
+	assert( r.add(70000) );
+	assert( r.add(0xffff'ffff) );
+	assert( r.contains(1) && r.contains(70000) && r.contains(0xffff'ffff) );
+	assert( !r.contains(2) && !r.contains(65536 + 1) );
+	assert( r.size() == 3 );
+	assert( r.chunk_count() == 3 );
+	assert( r.remove(70000) );
+	assert( !r.remove(70000) );
+	assert( r.chunk_count() == 2 );
+	assert(( to_values(r) == values{1, 0xffff'ffff} ));
+
+	// array grows into a bitmap and shrinks back
+	roaring_bitmap dense;
+	for(std::uint32_t i = 0; i < 10000; ++i)
+		dense.add(i * 3);
+	assert( dense.size() == 10000 );
+	assert( dense.chunk(0).type == detail::roaring::kind::bitmap );
+	for(std::uint32_t i = 0; i < 10000; ++i)
+		assert( dense.contains(i * 3) && !dense.contains(i * 3 + 1) );
+	for(std::uint32_t i = 0; i < 8000; ++i)
+		dense.remove(i * 3);
+	assert( dense.size() == 2000 );
+	assert( dense.chunk(0).type == detail::roaring::kind::array );
+
+	// runs
+	roaring_bitmap ranges;
+	for(std::uint32_t i = 100; i < 60000; ++i)
+		ranges.add(i);
+	ranges.optimize();
+	assert( ranges.chunk(0).type == detail::roaring::kind::run );
+	assert( ranges.size() == 59900 );
+	assert( ranges.contains(100) && ranges.contains(59999) );
+	assert( !ranges.contains(99) && !ranges.contains(60000) );
+	assert( ranges.add(99) );
+	assert( ranges.size() == 59901 );
+	ranges.optimize();
+	assert( ranges.chunk(0).type == detail::roaring::kind::run );
+	assert( ranges.remove(1000) );
+	assert( !ranges.contains(1000) && ranges.size() == 59900 );
+	ranges.optimize();
+	assert( ranges.chunk(0).type == detail::roaring::kind::run );
+	assert( ranges.chunk(0).size == 2 );
+
+	roaring_bitmap list{5, 3, 1, 3};
+	assert(( to_values(list) == values{1, 3, 5} ));
+	assert(( list == roaring_bitmap{1, 3, 5} ));
+	assert(( list != roaring_bitmap{1, 3} ));
+}
+
+// a mix of sparse, dense and run chunks
+roaring_bitmap random_set(random::engine::tiny<unsigned long long>& random, std::set<std::uint32_t>& reference)
+{
+	roaring_bitmap result;
+	auto add = [&](std::uint32_t value)
+	{
+		result.add(value);
+		reference.insert(value);
+	};
+	std::uniform_int_distribution<std::uint32_t> chunk{0, 7};
+	std::uniform_int_distribution<std::uint32_t> low{0, 0xffff};
+	for(int i = 0; i < 6; ++i)
+	{
+		const std::uint32_t high = chunk(random) << 16;
+		switch(random() % 3)
+		{
+			case 0:
+				for(int j = 0; j < 500; ++j)
+					add(high | low(random));
+			break;
+			case 1:
+				for(int j = 0; j < 20000; ++j)
+					add(high | low(random));
+			break;
+			case 2:
+				for(int j = 0; j < 10; ++j)
+				{
+					const std::uint32_t first = low(random);
+					const std::uint32_t last = std::min<std::uint32_t>(first + low(random) % 3000, 0xffff);
+					for(std::uint32_t value = first; value <= last; ++value)
+						add(high | value);
+				}
+			break;
+		}
+	}
+	if(random() % 2)
+		result.optimize();
+	return result;
+}
+
+void SetOperations()
+{
+	auto seed = std::random_device{}();
+	std::cout << "Roaring set operations test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+
+	for(int i = 0; i < 50; ++i)
+	{
+		std::set<std::uint32_t> a_set, b_set;
+		const auto a = random_set(random, a_set);
+		const auto b = random_set(random, b_set);
+		assert( to_values(a) == values(a_set.begin(), a_set.end()) );
+		assert( a.size() == a_set.size() );
+
+		values expected;
+		std::set_union(a_set.begin(), a_set.end(), b_set.begin(), b_set.end(), std::back_inserter(expected));
+		auto result = a | b;
+		assert( to_values(result) == expected );
+		assert( result.size() == expected.size() );
+
+		expected.clear();
+		std::set_intersection(a_set.begin(), a_set.end(), b_set.begin(), b_set.end(), std::back_inserter(expected));
+		result = a & b;
+		assert( to_values(result) == expected );
+		assert( result.size() == expected.size() );
+
+		expected.clear();
+		std::set_difference(a_set.begin(), a_set.end(), b_set.begin(), b_set.end(), std::back_inserter(expected));
+		result = a - b;
+		assert( to_values(result) == expected );
+		assert( result.size() == expected.size() );
+
+		auto optimized = a;
+		optimized.optimize();
+		assert( optimized == a );
+		assert( (a - a).empty() );
+		assert( (a & a) == a );
+		assert( (a | a) == a );
+
+		result = a;
+		result |= b;
+		assert( result == (a | b) );
+		result -= b;
+		assert( result == (a - b) );
+		result &= a;
+		assert( result == (a - b) );
+	}
+}
+
+// adds and removes one at a time, in every kind of container
+void AddRemove()
+{
+	using detail::roaring::kind;
+	using detail::roaring::max_array;
+
+	auto seed = std::random_device{}();
+	std::cout << "Roaring add remove test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+
+	for(int i = 0; i < 20; ++i)
+	{
+		std::set<std::uint32_t> reference;
+		auto r = random_set(random, reference);
+		r.optimize();
+		std::uniform_int_distribution<std::uint32_t> value{0, (8u << 16) - 1};
+		for(int j = 0; j < 20000; ++j)
+		{
+			// mostly near the existing ones, to hit the edges of runs
+			auto v = value(random);
+			if(random() % 2)
+			{
+				const auto near = reference.lower_bound(v);
+				if(near != reference.end())
+					v = *near + std::uint32_t(random() % 3) - 1;
+			}
+			if(random() % 2)
+				assert( r.add(v) == reference.insert(v).second );
+			else
+				assert( r.remove(v) == (reference.erase(v) != 0) );
+		}
+		assert( to_values(r) == values(reference.begin(), reference.end()) );
+		assert( r.size() == reference.size() );
+		// the runs are kept merged, so they compare same as freshly made ones
+		assert( r == roaring_bitmap(reference.begin(), reference.end()) );
+		for(std::size_t chunk = 0; chunk < r.chunk_count(); ++chunk)
+			if(r.chunk(chunk).type != kind::run)
+				assert( (r.chunk(chunk).type == kind::array) == (r.chunk(chunk).cardinality <= max_array) );
+	}
+
+	// the bitmap turns back into an array exactly at the limit
+	roaring_bitmap r;
+	for(std::uint32_t v = 0; v <= max_array; ++v)
+		r.add(v * 2);
+	assert( r.chunk(0).type == kind::bitmap );
+	r.remove(0);
+	assert( r.chunk(0).type == kind::array );
+	assert( r.size() == max_array );
+	assert( !r.contains(0) && r.contains(2) && r.contains(max_array * 2) );
+
+	// runs split and join without conversion
+	roaring_bitmap runs;
+	for(std::uint32_t v = 0; v < 1000; ++v)
+		runs.add(v);
+	runs.optimize();
+	assert( runs.remove(500) );
+	assert( runs.chunk(0).type == kind::run && runs.chunk(0).size == 2 );
+	assert( runs.remove(0) && runs.remove(999) );
+	assert( runs.chunk(0).type == kind::run && runs.chunk(0).size == 2 );
+	assert( runs.add(2000) );
+	assert( runs.chunk(0).type == kind::run && runs.chunk(0).size == 3 );
+	assert( runs.add(500) );
+	assert( runs.chunk(0).type == kind::run && runs.chunk(0).size == 2 );
+	assert( runs.size() == 999 );
+	assert( !runs.contains(0) && runs.contains(1) && runs.contains(500) && !runs.contains(999) );
+}
+
+void Serialization()
+{
+	auto seed = std::random_device{}();
+	std::cout << "Roaring serialization test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+
+	for(int i = 0; i < 20; ++i)
+	{
+		std::set<std::uint32_t> a_set, b_set;
+		const auto a = random_set(random, a_set);
+		const auto b = random_set(random, b_set);
+
+		// offset by one to make sure nothing relies on alignment
+		std::vector<std::byte> buffer(a.serialized_size() + 1);
+		auto end = a.serialize(buffer.data() + 1);
+		assert( end == buffer.data() + buffer.size() );
+
+		const roaring_view view(buffer.data() + 1, buffer.size() - 1);
+		assert( view.size() == a.size() );
+		assert( view.chunk_count() == a.chunk_count() );
+		assert( to_values(view) == to_values(a) );
+		for(auto value : a_set)
+			assert( view.contains(value) );
+		assert( view == a );
+		assert( view.to_bitmap() == a );
+
+		assert( (view | b) == (a | b) );
+		assert( (b & view) == (b & a) );
+		assert( (view - view) == roaring_bitmap{} );
+		auto result = b;
+		result -= view;
+		assert( result == (b - a) );
+	}
+
+	roaring_bitmap empty;
+	std::vector<std::byte> buffer(empty.serialized_size());
+	empty.serialize(buffer.data());
+	assert( roaring_view(buffer.data(), buffer.size()).empty() );
+	assert( roaring_view(buffer.data(), buffer.size()).size() == 0 );
+}
+
+void CorruptedSerialization()
+{
+	using namespace detail::roaring;
+
+	// an array, a bitmap and a run container
+	roaring_bitmap r;
+	for(std::uint32_t value = 0; value < 10; ++value)
+		r.add(value * 3);
+	for(std::uint32_t value = 0; value < 10'000; ++value)
+		r.add((1u << chunk_bits) + value * 5);
+	for(std::uint32_t value = 0; value < 1000; ++value)
+		r.add((2u << chunk_bits) + value);
+	r.optimize();
+	assert( r.chunk(0).type == kind::array );
+	assert( r.chunk(1).type == kind::bitmap );
+	assert( r.chunk(2).type == kind::run );
+
+	std::vector<std::byte> buffer(r.serialized_size());
+	r.serialize(buffer.data());
+	const auto view = roaring_view::from(buffer.data(), buffer.size());
+	assert( view && *view == r );
+
+	// every truncation
+	for(std::size_t size = 0; size < buffer.size(); ++size)
+		assert( !roaring_view::from(buffer.data(), size) );
+
+	auto corrupted = [&buffer](std::size_t offset, auto value)
+	{
+		auto copy = buffer;
+		store(copy.data() + offset, value);
+		return !roaring_view::from(copy.data(), copy.size());
+	};
+	auto field = [](std::size_t chunk, std::size_t offset)
+	{ return header_size + chunk * descriptor_size + offset; };
+	constexpr std::size_t key = 0, type = 2, cardinality = 4, size = 8, offset = 12;
+
+	// chunk count that the descriptors don't fit
+	assert( corrupted(0, std::uint32_t{4}) );
+	assert( corrupted(0, ~std::uint32_t{}) );
+	// keys out of order
+	assert( corrupted(field(1, key), std::uint16_t{0}) );
+	assert( corrupted(field(2, key), std::uint16_t{1}) );
+	// unknown kind
+	assert( corrupted(field(0, type), std::uint16_t{3}) );
+	assert( corrupted(field(1, type), ~std::uint16_t{}) );
+	// kind that doesn't match the size
+	assert( corrupted(field(0, type), std::uint16_t(kind::bitmap)) );
+	assert( corrupted(field(1, type), std::uint16_t(kind::array)) );
+	// sizes and cardinalities that don't fit
+	assert( corrupted(field(0, cardinality), std::uint32_t{0}) );
+	assert( corrupted(field(0, size), std::uint32_t{11}) );
+	assert( corrupted(field(1, size), std::uint32_t(bitmap_words + 1)) );
+	assert( corrupted(field(2, size), ~std::uint32_t{}) );
+	assert( corrupted(field(2, cardinality), std::uint32_t{(1u << chunk_bits) + 1}) );
+	// data out of bounds, or in the descriptors
+	assert( corrupted(field(2, offset), std::uint32_t(buffer.size())) );
+	assert( corrupted(field(1, offset), ~std::uint32_t{}) );
+	assert( corrupted(field(0, offset), std::uint32_t{0}) );
+
+	// the values themselves are not checked, but can't take it out of bounds either
+	for(std::size_t i = field(3, 0); i < buffer.size(); i += 13)
+	{
+		auto copy = buffer;
+		copy[i] = ~copy[i];
+		const auto changed = roaring_view::from(copy.data(), copy.size());
+		assert( changed );
+		for(std::uint32_t value = 0; value < (3u << chunk_bits); value += 101)
+			void(changed->contains(value));
+		void(changed->size());
+		void(changed->to_bitmap());
+	}
+}
+
+int main()
+{
+	Basics();
+	SetOperations();
+	AddRemove();
+	Serialization();
+	CorruptedSerialization();
+	return 0;
+}
@@ -61,6 +61,58 @@ constexpr auto tuple_tie(std::tuple<T...>& t)
 	return std::apply(std::tie<T...>, t);
 }
 
+template <std::size_t... I>
+constexpr auto index_tuple(std::index_sequence<I...>)
+{
+	return std::tuple<std::integral_constant<std::size_t, I>...>{};
+}
+
+template <std::size_t Size>
+constexpr bool ApplyForSize()
+{
+	constexpr auto t = index_tuple(std::make_index_sequence<Size>{});
+	auto to_size = [](auto index) -> std::size_t { return index; };
+	for(std::size_t i = 0; i < Size; ++i)
+		if(apply_for(i, to_size, t) != i)
+			return false;
+
+	// visited in order, exactly once
+	for(std::size_t lower = 0; lower <= Size; ++lower)
+	{
+		std::size_t expected = lower;
+		bool ordered = true;
+		apply_for({lower, Size}, [&](auto index)
+		{
+			ordered &= index == expected;
+			++expected;
+		}, t);
+		if(!ordered || expected != Size)
+			return false;
+	}
+	return true;
+}
+
+void ApplyForLarge()
+{
+	static_assert(ApplyForSize<2>());
+	static_assert(ApplyForSize<16>());
+	assert(ApplyForSize<64>());
+
+	// multiple tuples, the first decides the size
+	auto a = std::tuple(1, 2.5, 3u);
+	auto b = std::tuple(10, 20.5, 30u, "extra"s);
+	apply_for(1, [](auto& x, auto y) { x += y; }, a, b);
+	assert( std::tuple(1, 23.0, 3u) == a );
+	apply_for({0,3}, [](auto& x, auto y) { x += y; }, a, b);
+	assert( std::tuple(11, 43.5, 33u) == a );
+
+	// moves each element out of an rvalue tuple only once
+	std::string moved_out;
+	apply_for({0,2}, [&](auto&& x) { moved_out += std::string(std::move(x)); },
+		std::tuple("one"s, "two"s));
+	assert( "onetwo" == moved_out );
+}
+
 void CarCdr()
 {
 
@@ -522,9 +574,39 @@ void MetaFlatten()
 	>);
 }
 
+// more elements than the default template instantiation depth allows for recursion on them
+template <std::size_t... I>
+auto make_long_tuple(std::index_sequence<I...>)
+	-> std::tuple<std::integral_constant<std::size_t, I>...>;
+using long_tuple = decltype(make_long_tuple(std::make_index_sequence<1000>{}));
+
+template <typename T>
+struct is_last_long : std::bool_constant<T::value == 999> {};
+
+template <typename T>
+struct pair_up { using type = std::tuple<T, T>; };
+
+void MetaLongTuple()
+{
+	static_assert(find_v<std::integral_constant<std::size_t, 999>, long_tuple> == 999);
+	static_assert(find_v<std::integral_constant<std::size_t, 7>, long_tuple, 8> == 1000);
+	static_assert(find_if_v<is_last_long, long_tuple> == 999);
+	static_assert(find_if_t<is_last_long, long_tuple>::value == 999);
+	static_assert(std::tuple_size_v<flatten_t<long_tuple>> == 1000);
+	static_assert(std::tuple_size_v<flatten_t<long_tuple, pair_up>> == 2000);
+	static_assert(std::tuple_element_t<1999, flatten_t<long_tuple, pair_up>>::value == 999);
+	static_assert(std::tuple_element_t<998, tuple_cdr_t<long_tuple>>::value == 999);
+	static_assert(std::is_same_v<
+		subtuple_t<long_tuple, std::index_sequence<999, 0>>,
+		std::tuple<std::integral_constant<std::size_t, 999>, std::integral_constant<std::size_t, 0>>
+	>);
+	static_assert(car<std::make_index_sequence<1000>, 999> == 999);
+}
+
 int main()
 {
 	ApplyFor();
+	ApplyForLarge();
 	CarCdr();
 	TransformBasic();
 	TransformCopyCount();
@@ -534,5 +616,6 @@ int main()
 	Pend();
 	MetaFind();
 	MetaFlatten();
+	MetaLongTuple();
 	return 0;
 }
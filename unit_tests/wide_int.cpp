@@ -0,0 +1,193 @@
+#include "simple/support/wide_int.hpp"
+#include "simple/support/random.hpp"
+#include <cassert>
+#include <cstdint>
+#include <random>
+#include <iostream>
+#include <iomanip>
+
+using namespace simple::support;
+
+using u128 = wide_uint<128>;
+using u256 = wide_uint<256>;
+using i128 = wide_int<128>;
+
+__extension__ using builtin_u128 = unsigned __int128;
+__extension__ using builtin_i128 = __int128;
+
+builtin_u128 to_builtin(const u128& x)
+{
+	return (builtin_u128(x.words[1]) << 64) | x.words[0];
+}
+
+u128 from_builtin(builtin_u128 x)
+{
+	u128 result;
+	result.words[0] = std::uint64_t(x);
+	result.words[1] = std::uint64_t(x >> 64);
+	return result;
+}
+
+// reference schoolbook full product, to check karatsuba against
+template <std::size_t Bits>
+wide_uint<2 * Bits> naive_full_product(const wide_uint<Bits>& one, const wide_uint<Bits>& other)
+{
+	wide_uint<2 * Bits> result;
+	for(std::size_t i = 0; i < Bits; ++i)
+		if((one.words[i / 64] >> (i % 64)) & 1)
+			result += wide_uint<2 * Bits>(other) << i;
+	return result;
+}
+
+constexpr bool Constexpr()
+{
+	constexpr u128 max = ~u128{};
+	static_assert( max + 1 == 0 );
+	static_assert( u128(0) - 1 == max );
+	static_assert( (u128(1) << 100) >> 99 == 2 );
+	static_assert( full_product(~std::uint64_t{}, ~std::uint64_t{}) == max - (u128(1) << 65) + 2 );
+	static_assert( mul_high(std::uint64_t{1} << 63, 4) == 2 );
+	static_assert( (u256(1) << 200) / (u256(1) << 100) == u256(1) << 100 );
+	static_assert( (u256(1) << 200) % 7 == 4 ); // 2^3 = 1 mod 7, 200 = 3*66 + 2
+	static_assert( bit_width(u256(1) << 255) == 256 );
+	static_assert( i128(-7) / 2 == -3 );
+	static_assert( i128(-7) % 2 == -1 );
+	static_assert( i128(-8) >> 1 == -4 );
+	static_assert( i128(-1) < i128(0) );
+	static_assert( std::numeric_limits<i128>::min() < std::numeric_limits<i128>::max() );
+	static_assert( std::numeric_limits<i128>::max() + 1 == std::numeric_limits<i128>::min() );
+	static_assert( wide_int<256>(i128(-5)) == -5 );
+
+	u128 x = 41;
+	++x;
+	x *= 10;
+	x -= 20;
+	return x == 400;
+}
+static_assert(Constexpr());
+
+void AgainstBuiltin()
+{
+	auto seed = std::random_device{}();
+	std::cout << "Wide int test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+
+	auto random_value = [&random]()
+	{
+		// mix of small and wide, to hit both division paths
+		builtin_u128 value = (builtin_u128(random()) << 64) | random();
+		switch(random() % 4)
+		{
+			case 0: return value >> (random() % 128);
+			case 1: return value & ~std::uint64_t{};
+			default: return value;
+		}
+	};
+
+	for(int i = 0; i < 100000; ++i)
+	{
+		const builtin_u128 a = random_value(), b = random_value();
+		const u128 wa = from_builtin(a), wb = from_builtin(b);
+		const auto shift = random() % 128;
+
+		assert( to_builtin(wa + wb) == a + b );
+		assert( to_builtin(wa - wb) == a - b );
+		assert( to_builtin(wa * wb) == a * b );
+		assert( to_builtin(wa & wb) == (a & b) );
+		assert( to_builtin(wa | wb) == (a | b) );
+		assert( to_builtin(wa ^ wb) == (a ^ b) );
+		assert( to_builtin(wa << shift) == a << shift );
+		assert( to_builtin(wa >> shift) == a >> shift );
+		assert( (wa < wb) == (a < b) );
+		assert( (wa == wb) == (a == b) );
+		if(b != 0)
+		{
+			assert( to_builtin(wa / wb) == a / b );
+			assert( to_builtin(wa % wb) == a % b );
+		}
+
+		const std::uint64_t x = random(), y = random();
+		assert( to_builtin(full_product(x, y)) == builtin_u128(x) * y );
+		assert( mul_high(x, y) == std::uint64_t((builtin_u128(x) * y) >> 64) );
+
+		u128 sum;
+		builtin_u128 builtin_sum;
+		assert( add_overflow(sum, wa, wb) == __builtin_add_overflow(a, b, &builtin_sum) );
+		assert( to_builtin(sum) == builtin_sum );
+
+		const auto sa = builtin_i128(a), sb = builtin_i128(b);
+		const auto wsa = i128(wa), wsb = i128(wb);
+		assert( (wsa < wsb) == (sa < sb) );
+		assert( builtin_i128(to_builtin((wsa >> shift).bits)) == sa >> shift );
+		if(sb != 0 && !(sb == -1 && sa == builtin_i128(builtin_u128(1) << 127)))
+		{
+			assert( builtin_i128(to_builtin((wsa / wsb).bits)) == sa / sb );
+			assert( builtin_i128(to_builtin((wsa % wsb).bits)) == sa % sb );
+		}
+
+		i128 signed_result;
+		builtin_i128 builtin_signed_result;
+		assert( add_overflow(signed_result, wsa, wsb) == __builtin_add_overflow(sa, sb, &builtin_signed_result) );
+		assert( builtin_i128(to_builtin(signed_result.bits)) == builtin_signed_result );
+		assert( sub_overflow(signed_result, wsa, wsb) == __builtin_sub_overflow(sa, sb, &builtin_signed_result) );
+		assert( builtin_i128(to_builtin(signed_result.bits)) == builtin_signed_result );
+		assert( mul_overflow(signed_result, wsa, wsb) == __builtin_mul_overflow(sa, sb, &builtin_signed_result) );
+		assert( builtin_i128(to_builtin(signed_result.bits)) == builtin_signed_result );
+	}
+}
+
+template <std::size_t Bits>
+void Wide(random::engine::tiny<unsigned long long>& random)
+{
+	for(int i = 0; i < 200; ++i)
+	{
+		wide_uint<Bits> a, b;
+		for(auto& word : a.words)
+			word = random();
+		for(auto& word : b.words)
+			word = random();
+		a >>= random() % Bits;
+		b >>= random() % Bits;
+
+		const auto product = full_product(a, b);
+		assert( product == naive_full_product(a, b) );
+		assert( wide_uint<Bits>(product) == a * b );
+		assert( mul_high(a, b) == wide_uint<Bits>(product >> Bits) );
+
+		wide_uint<Bits> truncated;
+		assert( mul_overflow(truncated, a, b) == bool(product >> Bits) );
+
+		if(b)
+		{
+			const auto quotient = a / b, remainder = a % b;
+			assert( remainder < b );
+			assert( quotient * b + remainder == a );
+		}
+
+		const std::uint64_t divisor = random() | 1;
+		auto quotient = a;
+		const auto remainder = quotient.divide(divisor);
+		assert( remainder < divisor );
+		assert( quotient * divisor + remainder == a );
+		assert( quotient == a / divisor );
+	}
+}
+
+void WideKaratsuba()
+{
+	auto seed = std::random_device{}();
+	std::cout << "Wide int karatsuba test seed: " << std::hex << std::showbase << seed << std::endl;
+	random::engine::tiny<unsigned long long> random{seed};
+	Wide<192>(random);
+	Wide<256>(random);
+	Wide<512>(random);
+	Wide<1024>(random);
+	Wide<2048>(random);
+}
+
+int main()
+{
+	AgainstBuiltin();
+	WideKaratsuba();
+	return 0;
+}
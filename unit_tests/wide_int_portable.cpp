@@ -0,0 +1,2 @@
+#define SIMPLE_SUPPORT_WIDE_INT_DISABLE_INT128
+#include "wide_int.cpp"